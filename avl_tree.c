@@ -0,0 +1,141 @@
+/**
+ * Politica de balansare AVL pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Fiecare nod își păstrează înălțimea, iar după fiecare inserare drumul de la
+ * nodul nou spre rădăcină este rebalansat prin rotații. Diferența de înălțime
+ * dintre subarborii oricărui nod rămâne cel mult 1, deci get() este O(log n)
+ * indiferent de ordinea în care sosesc cheile.
+ */
+
+#include <stdlib.h>
+
+#include "avl_tree.h"
+
+/**
+ * Calculează factorul de balansare al unui nod
+ * @param tree_node Nodul curent
+ * @return Înălțimea subarborelui stâng minus înălțimea subarborelui drept
+ */
+static int avl_balance_factor(BinaryTreeNode * tree_node) {
+    return node_height(tree_node->left) - node_height(tree_node->right);
+}
+
+/**
+ * Actualizează înălțimea nodului și aplică rotațiile necesare dacă nodul s-a dezechilibrat
+ * @param tree_node Rădăcina subarborelui
+ * @return Noua rădăcină a subarborelui (după eventualele rotații)
+ */
+BinaryTreeNode * avl_rebalance(BinaryTreeNode * tree_node) {
+    update_node(tree_node);
+
+    int balance = avl_balance_factor(tree_node);
+
+    // Subarborele stâng este prea înalt
+    if (balance > 1) {
+        // Cazul stânga-dreapta: întâi rotim copilul stâng
+        if (avl_balance_factor(tree_node->left) < 0) {
+            tree_node->left = rotate_left(tree_node->left);
+        }
+        return rotate_right(tree_node);
+    }
+
+    // Subarborele drept este prea înalt
+    if (balance < -1) {
+        // Cazul dreapta-stânga: întâi rotim copilul drept
+        if (avl_balance_factor(tree_node->right) > 0) {
+            tree_node->right = rotate_right(tree_node->right);
+        }
+        return rotate_left(tree_node);
+    }
+
+    return tree_node;
+}
+
+/**
+ * Inserează un nod nou în arborele AVL și rebalansează drumul spre rădăcină
+ * Cheile egale sunt trimise la dreapta, la fel ca în insert() pentru arborele simplu.
+ * Complexitate: O(log n)
+ * @param tree Arborele în care se inserează
+ * @param new_node Nodul care va fi inserat
+ */
+void avl_insert_node(BinaryTree * tree, BinaryTreeNode * new_node) {
+    // Drumul se memorează ca adrese ale legăturilor, ca rotațiile să poată înlocui subarborii
+    BinaryTreeNode ** path[AVL_MAX_HEIGHT];
+    int depth = 0;
+    int key = new_node->key;
+
+    BinaryTreeNode ** link = &tree->root;
+    while (*link) {
+        path[depth++] = link;
+        link = ((*link)->key > key) ? &(*link)->left : &(*link)->right;
+    }
+    *link = new_node;
+
+    // Urcăm spre rădăcină; ne oprim când înălțimea unui subarbore nu se mai schimbă
+    while (depth > 0) {
+        BinaryTreeNode ** parent_link = path[--depth];
+        int old_height = (*parent_link)->height;
+
+        *parent_link = avl_rebalance(*parent_link);
+
+        if ((*parent_link)->height == old_height) break;
+    }
+}
+
+/**
+ * Șterge din arborele AVL nodul cu cheia dată și rebalansează drumul spre rădăcină
+ * Un nod cu doi copii preia cartea succesorului, iar succesorul este eliminat.
+ * Complexitate: O(log n)
+ * @param tree Arborele din care se șterge
+ * @param key Cheia căutată
+ * @return true dacă nodul a fost găsit și șters, false altfel
+ */
+bool avl_delete(BinaryTree * tree, int key) {
+    BinaryTreeNode ** path[AVL_MAX_HEIGHT];
+    int depth = 0;
+
+    // Căutăm nodul, memorând legăturile de pe drum
+    BinaryTreeNode ** link = &tree->root;
+    while (*link && (*link)->key != key) {
+        path[depth++] = link;
+        link = ((*link)->key > key) ? &(*link)->left : &(*link)->right;
+    }
+
+    if (!*link) return false;  // Nu există nod cu cheia specificată
+
+    BinaryTreeNode * target = *link;
+    BinaryTreeNode * removed = target;
+
+    if (target->left && target->right) {
+        // Succesorul este cel mai din stânga nod al subarborelui drept
+        path[depth++] = link;
+        link = &target->right;
+        while ((*link)->left) {
+            path[depth++] = link;
+            link = &(*link)->left;
+        }
+        removed = *link;
+
+        Book * temp = target->book;
+        target->book = removed->book;
+        removed->book = temp;
+        target->key = removed->key;
+    }
+
+    // Nodul eliminat are cel mult un copil, care îi ia locul
+    *link = removed->left ? removed->left : removed->right;
+    destroy_tree_node(tree, removed);
+
+    // Urcăm spre rădăcină; ne oprim când înălțimea unui subarbore nu se mai schimbă
+    while (depth > 0) {
+        BinaryTreeNode ** parent_link = path[--depth];
+        int old_height = (*parent_link)->height;
+
+        *parent_link = avl_rebalance(*parent_link);
+
+        if ((*parent_link)->height == old_height) break;
+    }
+
+    return true;
+}
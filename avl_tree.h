@@ -0,0 +1,20 @@
+/**
+ * Politica de balansare AVL pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_AVL_TREE_H
+#define SDA_LAB4_AVL_TREE_H
+
+#include <stdbool.h>
+
+#include "binary_tree.h"
+
+/* Înălțimea maximă a unui arbore AVL cu cel mult 2^31 noduri este sub 1.45 * 31 */
+#define AVL_MAX_HEIGHT 64
+
+BinaryTreeNode * avl_rebalance(BinaryTreeNode * tree_node);
+void avl_insert_node(BinaryTree * tree, BinaryTreeNode * new_node);
+bool avl_delete(BinaryTree * tree, int key);
+
+#endif // SDA_LAB4_AVL_TREE_H
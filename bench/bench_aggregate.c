@@ -0,0 +1,109 @@
+/**
+ * Benchmark: suma și maximul tirajelor pe un interval, cu agregate vs. parcurgere
+ * Utilizare: bench_aggregate [n] [interogări]   (implicit 1000000 10000)
+ *
+ * Fără agregate, range_query() vizitează fiecare carte din interval; cu agregate,
+ * range_sum()/range_max() coboară doar pe drumurile spre capete.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/* Parcurgerea costă O(lățimea intervalului), deci se măsoară doar câteva interogări */
+#define SLOW_QUERIES 20
+
+typedef struct ScanTotals {
+    long long sum;
+    int max;
+} ScanTotals;
+
+static bool accumulate(BinaryTreeNode * tree_node, void * context) {
+    ScanTotals * totals = (ScanTotals *)context;
+    totals->sum += tree_node->book->quantity_sold;
+    if (tree_node->book->quantity_sold > totals->max) totals->max = tree_node->book->quantity_sold;
+    return true;
+}
+
+static BinaryTree * build(const int * keys, size_t n, bool aggregates, double * elapsed) {
+    BinaryTree * tree = create_tree(TREE_AVL);
+    if (aggregates) enable_quantity_aggregates(tree);
+    uint64_t seed = 5;
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        int quantity = (int)(bench_rand(&seed) % 100000);
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, quantity));
+    }
+    *elapsed = bench_now() - start;
+    return tree;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t queries = bench_arg(argc, argv, 2, 10000);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    double plain_insert, augmented_insert;
+    BinaryTree * plain_tree = build(keys, n, false, &plain_insert);
+    BinaryTree * tree = build(keys, n, true, &augmented_insert);
+
+    printf("n = %zu (AVL)\n", n);
+    printf("  inserare fara agregate %.3f s, cu agregate %.3f s (+%.0f%%)\n",
+           plain_insert, augmented_insert, (augmented_insert / plain_insert - 1.0) * 100.0);
+
+    // Nodul mai mare (56 de octeți în loc de 40) se vede și la căutări
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) get(plain_tree, keys[i]);
+    double plain_get = (bench_now() - start) / (double)n;
+    start = bench_now();
+    for (size_t i = 0; i < n; i++) get(tree, keys[i]);
+    double augmented_get = (bench_now() - start) / (double)n;
+    printf("  get fara agregate %.0f ns, cu agregate %.0f ns\n", plain_get * 1e9, augmented_get * 1e9);
+
+    // Intervale late: în medie o treime din chei
+    uint64_t seed = 17;
+    int * lows = (int *)malloc(queries * sizeof(int));
+    int * highs = (int *)malloc(queries * sizeof(int));
+    for (size_t i = 0; i < queries; i++) {
+        int a = (int)(bench_rand(&seed) % n);
+        int b = (int)(bench_rand(&seed) % n);
+        lows[i] = a < b ? a : b;
+        highs[i] = a < b ? b : a;
+    }
+
+    long long checksum = 0;
+    start = bench_now();
+    for (size_t i = 0; i < queries; i++) {
+        checksum += range_sum(tree, lows[i], highs[i]) + range_max(tree, lows[i], highs[i]);
+    }
+    double fast = (bench_now() - start) / (double)queries;
+
+    start = bench_now();
+    for (size_t i = 0; i < SLOW_QUERIES; i++) {
+        ScanTotals totals = { 0, NOT_FOUND_QUANTITY };
+        range_query(plain_tree, lows[i], highs[i], accumulate, &totals);
+        if (totals.sum != range_sum(tree, lows[i], highs[i]) || totals.max != range_max(tree, lows[i], highs[i])) {
+            printf("eroare agregate\n");
+            return 1;
+        }
+    }
+    double slow = (bench_now() - start) / SLOW_QUERIES;
+
+    printf("  range_sum + range_max:   %.2f us / interval\n", fast * 1e6);
+    printf("  range_query cu vizitator: %.2f ms / interval (%.0fx mai lent)\n", slow * 1e3, slow / fast);
+
+    // Actualizarea tirajului recalculează doar drumul spre rădăcină
+    start = bench_now();
+    for (size_t i = 0; i < queries; i++) update_quantity(tree, lows[i], (int)(bench_rand(&seed) % 100000));
+    printf("  update_quantity:         %.2f us\n", (bench_now() - start) / (double)queries * 1e6);
+    printf("  (control %lld)\n", checksum);
+
+    free(lows);
+    free(highs);
+    free(keys);
+    free_tree(plain_tree);
+    free_tree(tree);
+    return 0;
+}
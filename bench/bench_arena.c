@@ -0,0 +1,99 @@
+/**
+ * Benchmark: încărcare și eliberare cu malloc per nod vs. alocatorul slab al arborelui
+ * Utilizare: bench_arena [n]   (implicit 1000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "binary_tree.h"
+#include "rb_tree.h"
+#include "bench_common.h"
+
+/**
+ * Varianta inițială: câte un malloc pentru carte și pentru nod, inserare simplă
+ */
+static BinaryTreeNode * legacy_load(int * keys, size_t n) {
+    BinaryTreeNode * root = NULL;
+    for (size_t i = 0; i < n; i++) {
+        Book * book = (Book *)malloc(sizeof(Book));
+        memset(book, 0, sizeof(Book));
+        book->key = keys[i];
+
+        BinaryTreeNode * node = (BinaryTreeNode *)malloc(sizeof(BinaryTreeNode));
+        node->book = book;
+        node->left = NULL;
+        node->right = NULL;
+
+        BinaryTreeNode ** link = &root;
+        while (*link) link = ((*link)->book->key > keys[i]) ? &(*link)->left : &(*link)->right;
+        *link = node;
+    }
+    return root;
+}
+
+/**
+ * Varianta inițială a eliberării: parcurgere în lățime și free pentru fiecare nod și carte
+ */
+static void legacy_clear(BinaryTreeNode * root) {
+    Queue * queue = create_queue();
+    if (root) enqueue(queue, root);
+    while (!is_queue_empty(queue)) {
+        BinaryTreeNode * node = dequeue(queue);
+        if (node->left) enqueue(queue, node->left);
+        if (node->right) enqueue(queue, node->right);
+        free(node->book);
+        free(node);
+    }
+    free_queue(queue);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    printf("n = %zu\n", n);
+
+    double start = bench_now();
+    BinaryTreeNode * legacy_root = legacy_load(keys, n);
+    double legacy_load_time = bench_now() - start;
+    start = bench_now();
+    legacy_clear(legacy_root);
+    double legacy_clear_time = bench_now() - start;
+    printf("  malloc per nod:  incarcare %.3f s   eliberare %.3f s\n", legacy_load_time, legacy_clear_time);
+
+    BinaryTree * tree = create_tree(TREE_UNBALANCED);
+    start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    }
+    double slab_load_time = bench_now() - start;
+    start = bench_now();
+    clear_tree(tree);
+    double slab_clear_time = bench_now() - start;
+    printf("  alocator slab:   incarcare %.3f s   eliberare %.3f s\n", slab_load_time, slab_clear_time);
+    free_tree(tree);
+
+    // Ștergeri și reinserări repetate: lista de obiecte libere ține memoria rezervată constantă
+    tree = create_tree(TREE_RED_BLACK);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    }
+    size_t reserved_before = tree->node_slab.reserved_bytes + tree->book_slab.reserved_bytes;
+    uint64_t seed = 3;
+    start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        int key = keys[bench_rand(&seed) % n];
+        rb_delete(tree, key);
+        insert(tree, create_book(tree, key, "", "", 2000, 100, 1000));
+    }
+    double churn_time = bench_now() - start;
+    size_t reserved_after = tree->node_slab.reserved_bytes + tree->book_slab.reserved_bytes;
+    printf("  churn RB (%zu stergeri+inserari): %.3f s, memorie rezervata %.1f MB -> %.1f MB\n",
+           n, churn_time, (double)reserved_before / 1048576.0, (double)reserved_after / 1048576.0);
+    free_tree(tree);
+
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * Benchmark: cărțile unui autor prin indexul după autor vs. parcurgerea arborelui
+ * Utilizare: bench_author [n] [autori]   (implicit 1000000 1000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/* Parcurgerea costă O(n), deci se măsoară doar câteva interogări */
+#define SLOW_QUERIES 10
+#define FAST_QUERIES 100000
+
+typedef struct AuthorFilter {
+    int author_id;
+    size_t count;
+} AuthorFilter;
+
+static bool match_author(BinaryTreeNode * tree_node, void * context) {
+    AuthorFilter * filter = (AuthorFilter *)context;
+    if (tree_node->book->author_id == filter->author_id) filter->count++;
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t authors = bench_arg(argc, argv, 2, 1000);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    BinaryTree * tree = create_tree(TREE_AVL);
+    char name[32];
+    uint64_t seed = 3;
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        snprintf(name, sizeof(name), "Autor %zu", (size_t)(bench_rand(&seed) % authors));
+        insert(tree, create_book(tree, keys[i], "", name, 2000, 100, 1000));
+    }
+    printf("n = %zu, %zu autori\n", n, authors);
+    printf("  inserare (cu index): %.3f s\n", bench_now() - start);
+    free(keys);
+
+    size_t matches = 0;
+    start = bench_now();
+    for (size_t i = 0; i < FAST_QUERIES; i++) {
+        snprintf(name, sizeof(name), "Autor %zu", (size_t)(bench_rand(&seed) % authors));
+        for (Book * book = find_books_by_author(tree, name); book; book = book->next_by_author) matches++;
+    }
+    double fast = (bench_now() - start) / FAST_QUERIES;
+
+    start = bench_now();
+    for (size_t i = 0; i < SLOW_QUERIES; i++) {
+        snprintf(name, sizeof(name), "Autor %zu", i);
+        AuthorFilter filter = { string_pool_find(&tree->strings, name), 0 };
+        traverse_tree(tree, TRAVERSAL_SVD, match_author, &filter);
+
+        size_t indexed = 0;
+        for (Book * book = find_books_by_author(tree, name); book; book = book->next_by_author) indexed++;
+        if (indexed != filter.count) {
+            printf("eroare index\n");
+            return 1;
+        }
+    }
+    double slow = (bench_now() - start) / SLOW_QUERIES;
+
+    printf("  index dupa autor: %.2f us / autor (%.0f carti in medie)\n", fast * 1e6, (double)matches / FAST_QUERIES);
+    printf("  parcurgere SVD:   %.2f ms / autor (%.0fx mai lent)\n", slow * 1e3, slow / fast);
+
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,56 @@
+/**
+ * Benchmark: inserare sortată vs. aleatoare, arbore simplu vs. arbore AVL
+ * Utilizare: bench_avl [n] [lookups]   (implicit 20000 100000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+static void run(const char * label, TreeBalanceMode mode, int * keys, size_t n, size_t lookups) {
+    BinaryTree * tree = create_tree(mode);
+
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    }
+    double insert_time = bench_now() - start;
+
+    uint64_t seed = 7;
+    long found = 0;
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) {
+        int key = (int)(bench_rand(&seed) % n);
+        if (get(tree, key)) found++;
+    }
+    double lookup_time = bench_now() - start;
+
+    printf("  %-22s depth=%-6d balansat=%-3s insert %.3f s   get %.1f ns/op (%ld gasite)\n",
+           label, get_tree_depth(tree), is_tree_balanced(tree) ? "da" : "nu",
+           insert_time, lookup_time * 1e9 / (double)lookups, found);
+
+    free_tree(tree);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 20000);
+    size_t lookups = bench_arg(argc, argv, 2, 100000);
+
+    int * sorted = (int *)malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)i;
+    int * shuffled = bench_shuffled_keys(n, 42);
+
+    printf("n = %zu, lookups = %zu\n", n, lookups);
+    printf(" chei sortate:\n");
+    run("simplu", TREE_UNBALANCED, sorted, n, lookups);
+    run("AVL", TREE_AVL, sorted, n, lookups);
+    printf(" chei aleatoare:\n");
+    run("simplu", TREE_UNBALANCED, shuffled, n, lookups);
+    run("AVL", TREE_AVL, shuffled, n, lookups);
+
+    free(sorted);
+    free(shuffled);
+    return 0;
+}
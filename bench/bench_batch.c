@@ -0,0 +1,60 @@
+/**
+ * Benchmark: buclă de get() vs. get_batch() cu căutări intercalate
+ * Utilizare: bench_batch [n] [lookups] [lot]   (implicit 1000000 5000000 256)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t lookups = bench_arg(argc, argv, 2, 5000000);
+    size_t batch = bench_arg(argc, argv, 3, 256);
+
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_AVL);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, 2 * keys[i], "", "", 2000, 100, 1000));
+    }
+    free(keys);
+
+    uint64_t seed = 31;
+    int * queries = (int *)malloc(lookups * sizeof(int));
+    for (size_t i = 0; i < lookups; i++) queries[i] = (int)(bench_rand(&seed) % (2 * n));
+    BinaryTreeNode ** single = (BinaryTreeNode **)malloc(lookups * sizeof(BinaryTreeNode *));
+    BinaryTreeNode ** batched = (BinaryTreeNode **)malloc(lookups * sizeof(BinaryTreeNode *));
+
+    double start = bench_now();
+    for (size_t i = 0; i < lookups; i++) single[i] = get(tree, queries[i]);
+    double single_time = bench_now() - start;
+
+    // Cererile sosesc în loturi de câteva sute, ca în interfața de interogare
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i += batch) {
+        size_t count = lookups - i < batch ? lookups - i : batch;
+        get_batch(tree, queries + i, count, batched + i);
+    }
+    double batch_time = bench_now() - start;
+
+    for (size_t i = 0; i < lookups; i++) {
+        if (single[i] != batched[i]) {
+            printf("eroare la cererea %zu\n", i);
+            return 1;
+        }
+    }
+
+    printf("n = %zu, lookups = %zu, lot = %zu, cautari intercalate = %d\n", n, lookups, batch, GET_BATCH_GROUP);
+    printf("  get() in bucla: %.2f M cereri/s (%.1f ns/op)\n",
+           (double)lookups / single_time / 1e6, single_time * 1e9 / (double)lookups);
+    printf("  get_batch():    %.2f M cereri/s (%.1f ns/op), %.2fx\n",
+           (double)lookups / batch_time / 1e6, batch_time * 1e9 / (double)lookups, single_time / batch_time);
+
+    free(single);
+    free(batched);
+    free(queries);
+    free_tree(tree);
+    return 0;
+}
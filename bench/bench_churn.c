@@ -0,0 +1,126 @@
+/**
+ * Benchmark: inserări, ștergeri și căutări amestecate în regim staționar
+ * Utilizare: bench_churn [n] [operații]   (implicit 100000 2000000)
+ *
+ * Arborele pornește cu n chei din intervalul [0, 2n). Fiecare operație alege o
+ * cheie aleatoare: jumătate din operații sunt căutări, restul inserează cheia
+ * dacă lipsește sau o șterg dacă există, așa că arborele rămâne în jur de n noduri.
+ * Al doilea scenariu este o fereastră glisantă: se inserează cheia i + n și se
+ * șterge cheia i, adică cea mai veche carte.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/* Peste această fereastră arborele simplu (degenerat în listă) nu mai este măsurat */
+#define UNBALANCED_WINDOW_LIMIT 10000
+
+static const char * mode_name(TreeBalanceMode mode) {
+    if (mode == TREE_AVL) return "AVL";
+    if (mode == TREE_RED_BLACK) return "rosu-negru";
+    return "simplu";
+}
+
+static int compare_doubles(const void * a, const void * b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void print_latencies(const char * label, double * latencies, size_t count, int depth) {
+    double total = 0.0;
+    for (size_t i = 0; i < count; i++) total += latencies[i];
+    qsort(latencies, count, sizeof(double), compare_doubles);
+    printf("  %-22s medie %6.0f ns  p50 %6.0f ns  p99 %7.0f ns  p99.9 %8.0f ns  adancime %d\n",
+           label, total * 1e9 / (double)count,
+           latencies[count / 2] * 1e9, latencies[count * 99 / 100] * 1e9,
+           latencies[count * 999 / 1000] * 1e9, depth);
+}
+
+static Book * make_book(BinaryTree * tree, int key) {
+    return create_book(tree, key, "", "", 2000, 100, 1000);
+}
+
+static void run_random(TreeBalanceMode mode, size_t n, size_t operations, double * latencies) {
+    BinaryTree * tree = create_tree(mode);
+    bool * present = (bool *)calloc(2 * n, sizeof(bool));
+
+    int * keys = bench_shuffled_keys(2 * n, 7);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, make_book(tree, keys[i]));
+        present[keys[i]] = true;
+    }
+    free(keys);
+
+    uint64_t seed = 99;
+    for (size_t i = 0; i < operations; i++) {
+        uint64_t r = bench_rand(&seed);
+        int key = (int)((r >> 1) % (2 * n));
+
+        double start = bench_now();
+        if (r & 1) {
+            get(tree, key);
+        } else if (present[key]) {
+            delete_key(tree, key);
+        } else {
+            insert(tree, make_book(tree, key));
+        }
+        latencies[i] = bench_now() - start;
+
+        if (!(r & 1)) present[key] = !present[key];
+    }
+
+    // Verificăm că arborele conține exact cheile așteptate
+    for (size_t key = 0; key < 2 * n; key++) {
+        if ((get(tree, (int)key) != NULL) != present[key]) {
+            printf("eroare: cheia %zu\n", key);
+            exit(1);
+        }
+    }
+
+    print_latencies(mode_name(mode), latencies, operations, get_tree_depth(tree));
+    free(present);
+    free_tree(tree);
+}
+
+static void run_window(TreeBalanceMode mode, size_t n, size_t operations, double * latencies) {
+    if (mode == TREE_UNBALANCED && n > UNBALANCED_WINDOW_LIMIT) {
+        printf("  %-22s omis (degenerează în listă, n > %d)\n", mode_name(mode), UNBALANCED_WINDOW_LIMIT);
+        return;
+    }
+
+    BinaryTree * tree = create_tree(mode);
+    int * keys = bench_shuffled_keys(n, 7);
+    for (size_t i = 0; i < n; i++) insert(tree, make_book(tree, keys[i]));
+    free(keys);
+
+    for (size_t i = 0; i < operations; i++) {
+        double start = bench_now();
+        insert(tree, make_book(tree, (int)(i + n)));
+        delete_key(tree, (int)i);
+        latencies[i] = bench_now() - start;
+    }
+
+    print_latencies(mode_name(mode), latencies, operations, get_tree_depth(tree));
+    free_tree(tree);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 100000);
+    size_t operations = bench_arg(argc, argv, 2, 2000000);
+    double * latencies = (double *)malloc(operations * sizeof(double));
+    TreeBalanceMode modes[] = { TREE_UNBALANCED, TREE_AVL, TREE_RED_BLACK };
+
+    printf("n = %zu, operatii = %zu\n", n, operations);
+    printf("cautari / inserari / stergeri aleatoare:\n");
+    for (int m = 0; m < 3; m++) run_random(modes[m], n, operations, latencies);
+
+    printf("fereastra glisanta (insereaza i + n, sterge i):\n");
+    for (int m = 0; m < 3; m++) run_window(modes[m], n, operations, latencies);
+
+    free(latencies);
+    return 0;
+}
@@ -0,0 +1,181 @@
+/**
+ * Utilitare comune pentru benchmark-uri
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_BENCH_COMMON_H
+#define SDA_LAB4_BENCH_COMMON_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * BENCH_SANITIZED este 1 când programul este compilat cu AddressSanitizer sau
+ * ThreadSanitizer (de exemplu cu -DSDA_SANITIZER=thread). Codul rulează atunci de
+ * zeci de ori mai încet, așa că benchmark-urile își pot micșora valorile implicite.
+ */
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define BENCH_SANITIZED 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define BENCH_SANITIZED 1
+#endif
+#endif
+#ifndef BENCH_SANITIZED
+#define BENCH_SANITIZED 0
+#endif
+
+/**
+ * Returnează timpul curent în secunde (ceas monoton)
+ * @return Timpul în secunde
+ */
+static inline double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Generator pseudo-aleator xorshift64*, determinist pentru rezultate reproductibile
+ * @param state Starea generatorului (nenulă)
+ * @return Următorul număr pseudo-aleator
+ */
+static inline uint64_t bench_rand(uint64_t * state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * Creează un tablou cu cheile 0..n-1 amestecate aleator (Fisher-Yates)
+ * @param n Numărul de chei
+ * @param seed Sămânța generatorului
+ * @return Tabloul alocat dinamic cu cheile amestecate
+ */
+static inline int * bench_shuffled_keys(size_t n, uint64_t seed) {
+    int * keys = (int *)malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) keys[i] = (int)i;
+    for (size_t i = n; i > 1; i--) {
+        size_t j = (size_t)(bench_rand(&seed) % i);
+        int temp = keys[i - 1];
+        keys[i - 1] = keys[j];
+        keys[j] = temp;
+    }
+    return keys;
+}
+
+/**
+ * Generează cereri cu distribuție Zipf peste cheile 0..n-1
+ * Cheia de rang r are probabilitatea proporțională cu 1 / r^s; rangurile sunt
+ * amestecate, ca cheile populare să fie răspândite prin arbore.
+ * @param n Numărul de chei
+ * @param count Numărul de cereri generate
+ * @param s Exponentul distribuției (de obicei aproape de 1)
+ * @param seed Sămânța generatorului
+ * @return Tabloul alocat dinamic cu cererile
+ */
+static inline int * bench_zipf_queries(size_t n, size_t count, double s, uint64_t seed) {
+    double * cumulative = (double *)malloc(n * sizeof(double));
+    double total = 0.0;
+    for (size_t r = 0; r < n; r++) {
+        total += 1.0 / pow((double)(r + 1), s);
+        cumulative[r] = total;
+    }
+
+    int * rank_to_key = bench_shuffled_keys(n, seed + 1);
+    int * queries = (int *)malloc(count * sizeof(int));
+    for (size_t i = 0; i < count; i++) {
+        double u = (double)(bench_rand(&seed) >> 11) / 9007199254740992.0 * total;
+        size_t low = 0, high = n - 1;
+        while (low < high) {
+            size_t middle = (low + high) / 2;
+            if (cumulative[middle] < u) low = middle + 1; else high = middle;
+        }
+        queries[i] = rank_to_key[low];
+    }
+
+    free(rank_to_key);
+    free(cumulative);
+    return queries;
+}
+
+/**
+ * Citește un număr din linia de comandă sau returnează valoarea implicită
+ * @param argc Numărul de argumente
+ * @param argv Argumentele
+ * @param index Poziția argumentului
+ * @param fallback Valoarea implicită
+ * @return Valoarea citită
+ */
+static inline size_t bench_arg(int argc, char ** argv, int index, size_t fallback) {
+    if (index < argc) return (size_t)strtoull(argv[index], NULL, 10);
+    return fallback;
+}
+
+/**
+ * Deschide un contor hardware pentru ratările de cache (doar pe Linux)
+ * În containere sau fără drepturi pentru perf contorul poate lipsi.
+ * @return Descriptorul contorului sau -1 dacă nu este disponibil
+ */
+static inline int bench_cache_miss_counter(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Pornește numărarea de la zero
+ * @param counter Descriptorul contorului (se ignoră dacă este -1)
+ */
+static inline void bench_counter_start(int counter) {
+#ifdef __linux__
+    if (counter < 0) return;
+    ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+#else
+    (void)counter;
+#endif
+}
+
+/**
+ * Oprește numărarea și returnează valoarea contorului
+ * @param counter Descriptorul contorului
+ * @return Numărul de evenimente sau -1 dacă contorul nu este disponibil
+ */
+static inline long long bench_counter_stop(int counter) {
+    long long value = -1;
+#ifdef __linux__
+    if (counter < 0) return -1;
+    ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(counter, &value, sizeof(value)) != (ssize_t)sizeof(value)) value = -1;
+#else
+    (void)counter;
+#endif
+    return value;
+}
+
+#endif // SDA_LAB4_BENCH_COMMON_H
@@ -0,0 +1,87 @@
+/**
+ * Benchmark: debitul căutărilor de la 1 la N fire, cu mutex global vs. zăvor cititori-scriitor
+ * Utilizare: bench_concurrent [n] [fire maxime] [căutări pe fir]   (implicit 1000000 8 1000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "binary_tree.h"
+#include "concurrent_tree.h"
+#include "bench_common.h"
+
+typedef struct ReaderJob {
+    ConcurrentTree * concurrent;       // Arborele comun
+    pthread_mutex_t * mutex;           // Mutexul global sau NULL pentru zăvorul arborelui
+    size_t n;                          // Cheile sunt 0..n-1
+    size_t lookups;                    // Numărul de căutări ale firului
+    uint64_t seed;                     // Sămânța firului
+    size_t found;                      // Rezultat, ca bucla să nu fie eliminată
+} ReaderJob;
+
+static void * reader(void * argument) {
+    ReaderJob * job = (ReaderJob *)argument;
+    uint64_t seed = job->seed;
+    size_t found = 0;
+
+    for (size_t i = 0; i < job->lookups; i++) {
+        int key = (int)(bench_rand(&seed) % job->n);
+        if (job->mutex) {
+            // Varianta de comparație: fiecare get() trece prin același mutex
+            pthread_mutex_lock(job->mutex);
+            found += get(job->concurrent->tree, key) != NULL;
+            pthread_mutex_unlock(job->mutex);
+        } else {
+            found += concurrent_get(job->concurrent, key, NULL, NULL);
+        }
+    }
+
+    job->found = found;
+    return NULL;
+}
+
+static double run(ConcurrentTree * concurrent, pthread_mutex_t * mutex, size_t n, int threads, size_t lookups) {
+    pthread_t ids[threads];
+    ReaderJob jobs[threads];
+
+    double start = bench_now();
+    for (int t = 0; t < threads; t++) {
+        jobs[t] = (ReaderJob){ concurrent, mutex, n, lookups, 0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1), 0 };
+        pthread_create(&ids[t], NULL, reader, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+        if (jobs[t].found != lookups) printf("eroare cautare\n");
+    }
+    double elapsed = bench_now() - start;
+
+    return (double)threads * (double)lookups / elapsed / 1e6;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    int max_threads = (int)bench_arg(argc, argv, 2, 8);
+    size_t lookups = bench_arg(argc, argv, 3, 1000000);
+
+    int * keys = bench_shuffled_keys(n, 42);
+    ConcurrentTree * concurrent = create_concurrent_tree(TREE_AVL);
+    for (size_t i = 0; i < n; i++) concurrent_insert(concurrent, keys[i], "", "", 2000, 100, 1000);
+    free(keys);
+
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex, NULL);
+
+    printf("n = %zu, %zu cautari pe fir, %ld procesoare\n", n, lookups, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("  fire   mutex global   zavor citire (milioane cautari/s)\n");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double locked = run(concurrent, &mutex, n, threads, lookups);
+        double shared = run(concurrent, NULL, n, threads, lookups);
+        printf("  %4d   %12.2f   %12.2f\n", threads, locked, shared);
+    }
+
+    pthread_mutex_destroy(&mutex);
+    free_concurrent_tree(concurrent);
+    return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * Benchmark: get() pe arborele cu pointeri vs. instantaneul Eytzinger (frozen_get)
+ * Utilizare: bench_frozen [n] [lookups]   (implicit 1000000 5000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "frozen_tree.h"
+#include "bench_common.h"
+
+static void run(const char * label, BinaryTree * tree, FrozenTree * frozen, int * queries, size_t lookups) {
+    long checksum = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < lookups; i++) {
+        BinaryTreeNode * node = get(tree, queries[i]);
+        checksum += node ? node->key : -1;
+    }
+    double tree_time = bench_now() - start;
+
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) {
+        Book * book = frozen_get(frozen, queries[i]);
+        checksum -= book ? book->key : -1;
+    }
+    double frozen_time = bench_now() - start;
+
+    printf("  %-10s get %.1f ns/op   frozen_get %.1f ns/op   (%.2fx, control %ld)\n", label,
+           tree_time * 1e9 / (double)lookups, frozen_time * 1e9 / (double)lookups,
+           tree_time / frozen_time, checksum);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t lookups = bench_arg(argc, argv, 2, 5000000);
+
+    // Cheile pare 0, 2, 4, ... pentru ca jumătate din cererile aleatoare să fie ratări
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_AVL);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, 2 * keys[i], "", "", 2000, 100, 1000));
+    }
+
+    double start = bench_now();
+    FrozenTree * frozen = freeze_tree(tree);
+    printf("n = %zu, lookups = %zu, freeze_tree %.3f s\n", n, lookups, bench_now() - start);
+
+    // Verificare: fiecare cheie și fiecare cheie lipsă dau același rezultat
+    for (size_t i = 0; i < 2 * n + 1; i++) {
+        BinaryTreeNode * node = get(tree, (int)i);
+        if ((node ? node->book : NULL) != frozen_get(frozen, (int)i)) {
+            printf("  eroare la cheia %zu\n", i);
+            return 1;
+        }
+    }
+
+    uint64_t seed = 13;
+    int * uniform = (int *)malloc(lookups * sizeof(int));
+    for (size_t i = 0; i < lookups; i++) uniform[i] = (int)(bench_rand(&seed) % (2 * n));
+    int * zipf = bench_zipf_queries(n, lookups, 0.99, 17);
+    for (size_t i = 0; i < lookups; i++) zipf[i] *= 2;
+
+    run("aleator:", tree, frozen, uniform, lookups);
+    run("Zipf:", tree, frozen, zipf, lookups);
+
+    free(uniform);
+    free(zipf);
+    free(keys);
+    free_frozen_tree(frozen);
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/**
+ * Benchmark: paginarea în ordinea cheilor cu TreeIterator vs. parcurgerea SVD
+ * Utilizare: bench_iterator [n] [pagini] [dimensiune pagină]   (implicit 1000000 10000 100)
+ *
+ * O pagină înseamnă "următoarele cărți după cheia K", cu K aleator. Fără
+ * iterator, singura variantă este o parcurgere SVD de la cea mai mică cheie,
+ * oprită (cu traverse_tree) după ce pagina s-a umplut.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "tree_iterator.h"
+#include "bench_common.h"
+
+typedef struct {
+    int from;                           // Prima cheie acceptată
+    int * page;                         // Cheile colectate
+    size_t count;
+    size_t capacity;
+} PageContext;
+
+static bool collect_page(BinaryTreeNode * tree_node, void * context) {
+    PageContext * page = (PageContext *)context;
+    if (tree_node->key < page->from) return true;  // Încă înainte de pagină
+    page->page[page->count++] = tree_node->key;
+    return page->count < page->capacity;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t pages = bench_arg(argc, argv, 2, 10000);
+    size_t page_size = bench_arg(argc, argv, 3, 100);
+
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_AVL);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, 2 * keys[i], "", "", 2000, 100, 1000));  // Chei pare
+    }
+    free(keys);
+
+    int * from = (int *)malloc(pages * sizeof(int));
+    uint64_t seed = 5;
+    for (size_t i = 0; i < pages; i++) from[i] = (int)(bench_rand(&seed) % (2 * n));
+
+    int * expected = (int *)malloc(pages * page_size * sizeof(int));
+    int * actual = (int *)malloc(pages * page_size * sizeof(int));
+    size_t * expected_count = (size_t *)malloc(pages * sizeof(size_t));
+
+    printf("n = %zu, %zu pagini de %zu carti\n", n, pages, page_size);
+
+    // Parcurgerea SVD cu oprire timpurie costă proporțional cu poziția paginii
+    size_t legacy_pages = pages < 200 ? pages : 200;
+    double start = bench_now();
+    for (size_t i = 0; i < legacy_pages; i++) {
+        PageContext page = { from[i], expected + i * page_size, 0, page_size };
+        traverse_tree(tree, TRAVERSAL_SVD, collect_page, &page);
+        expected_count[i] = page.count;
+    }
+    double legacy = (bench_now() - start) / (double)legacy_pages;
+    printf("  SVD cu oprire:   %10.1f us/pagina (%zu pagini masurate)\n", legacy * 1e6, legacy_pages);
+
+    TreeIterator * iterator = create_tree_iterator(tree);
+    start = bench_now();
+    for (size_t i = 0; i < pages; i++) {
+        int * out = actual + i * page_size;
+        size_t count = 0;
+        for (BinaryTreeNode * node = tree_iterator_seek(iterator, from[i]); node && count < page_size;
+             node = tree_iterator_next(iterator)) {
+            out[count++] = node->key;
+        }
+        if (i < legacy_pages && (count != expected_count[i] ||
+                                 memcmp(out, expected + i * page_size, count * sizeof(int)) != 0)) {
+            printf("eroare la pagina %zu\n", i);
+            return 1;
+        }
+    }
+    double paged = (bench_now() - start) / (double)pages;
+    printf("  TreeIterator:    %10.1f us/pagina   %.0fx\n", paged * 1e6, legacy / paged);
+
+    // Parcurgerea completă înainte și înapoi
+    start = bench_now();
+    size_t steps = 0;
+    int previous = -1;
+    for (BinaryTreeNode * node = tree_iterator_first(iterator); node; node = tree_iterator_next(iterator)) {
+        if (node->key <= previous) { printf("eroare: ordine\n"); return 1; }
+        previous = node->key;
+        steps++;
+    }
+    double forward = bench_now() - start;
+    start = bench_now();
+    for (BinaryTreeNode * node = tree_iterator_last(iterator); node; node = tree_iterator_prev(iterator)) steps--;
+    double backward = bench_now() - start;
+    printf("  next() pe tot arborele: %.1f ns/pas, prev(): %.1f ns/pas%s\n",
+           forward * 1e9 / (double)n, backward * 1e9 / (double)n, steps == 0 ? "" : " EROARE");
+
+    free_tree_iterator(iterator);
+    free(from);
+    free(expected);
+    free(actual);
+    free(expected_count);
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * Benchmark: get() aleator cu cheia în nod vs. cheia citită din carte (aranjamentul inițial)
+ * Utilizare: bench_layout [n] [lookups]   (implicit 2000000 2000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/**
+ * Nodul din versiunea inițială: fiecare comparație citește book->key
+ */
+typedef struct LegacyNode {
+    Book * book;
+    struct LegacyNode * left;
+    struct LegacyNode * right;
+} LegacyNode;
+
+static LegacyNode * legacy_insert(LegacyNode * root, Book * book) {
+    LegacyNode * node = (LegacyNode *)malloc(sizeof(LegacyNode));
+    node->book = book;
+    node->left = NULL;
+    node->right = NULL;
+    if (!root) return node;
+
+    LegacyNode ** link = &root;
+    while (*link) link = ((*link)->book->key > book->key) ? &(*link)->left : &(*link)->right;
+    *link = node;
+    return root;
+}
+
+static LegacyNode * legacy_get(LegacyNode * root, int key) {
+    while (root) {
+        if (root->book->key == key) return root;
+        root = (root->book->key > key) ? root->left : root->right;
+    }
+    return NULL;
+}
+
+static void legacy_free(LegacyNode * root) {
+    if (!root) return;
+    legacy_free(root->left);
+    legacy_free(root->right);
+    free(root);
+}
+
+static void report(const char * label, double seconds, long long misses, size_t lookups) {
+    printf("  %-18s %.1f ns/get", label, seconds * 1e9 / (double)lookups);
+    if (misses >= 0) printf("   %.2f ratari cache/get", (double)misses / (double)lookups);
+    printf("\n");
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 2000000);
+    size_t lookups = bench_arg(argc, argv, 2, 2000000);
+
+    int * keys = bench_shuffled_keys(n, 42);
+    int * queries = (int *)malloc(lookups * sizeof(int));
+    uint64_t seed = 11;
+    for (size_t i = 0; i < lookups; i++) queries[i] = (int)(bench_rand(&seed) % n);
+
+    // Ambele structuri au aceeași formă și împart aceleași cărți
+    BinaryTree * tree = create_tree(TREE_AVL);
+    LegacyNode * legacy_root = NULL;
+    for (size_t i = 0; i < n; i++) {
+        Book * book = create_book(tree, keys[i], "", "", 2000, 100, 1000);
+        insert(tree, book);
+    }
+    for (size_t i = 0; i < n; i++) legacy_root = legacy_insert(legacy_root, get(tree, keys[i])->book);
+
+    int counter = bench_cache_miss_counter();
+    printf("n = %zu, lookups = %zu, sizeof(BinaryTreeNode) = %zu, sizeof(Book) = %zu%s\n",
+           n, lookups, sizeof(BinaryTreeNode), sizeof(Book),
+           counter < 0 ? " (contoare perf indisponibile)" : "");
+
+    long checksum = 0;
+    bench_counter_start(counter);
+    double start = bench_now();
+    for (size_t i = 0; i < lookups; i++) checksum += legacy_get(legacy_root, queries[i])->book->pub_year;
+    double legacy_time = bench_now() - start;
+    long long legacy_misses = bench_counter_stop(counter);
+
+    bench_counter_start(counter);
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) checksum -= get(tree, queries[i])->book->pub_year;
+    double inline_time = bench_now() - start;
+    long long inline_misses = bench_counter_stop(counter);
+
+    report("cheie in carte:", legacy_time, legacy_misses, lookups);
+    report("cheie in nod:", inline_time, inline_misses, lookups);
+    printf("  (control %ld)\n", checksum);
+
+    legacy_free(legacy_root);
+    free_tree(tree);
+    free(queries);
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * Benchmark: inserări paralele cu chei aleatoare, zăvoare optimiste per nod vs. zăvor global
+ * Zăvorul global este cel de scriere din ConcurrentTree (arbore nebalansat, ca arborele OLC).
+ * Utilizare: bench_olc [n] [fire maxime]   (implicit 1000000 8)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "binary_tree.h"
+#include "concurrent_tree.h"
+#include "olc_tree.h"
+#include "bench_common.h"
+
+typedef struct InsertJob {
+    OlcTree * olc;                     // Arborele OLC (sau NULL)
+    ConcurrentTree * concurrent;       // Arborele cu zăvor global (sau NULL)
+    const int * keys;                  // Toate cheile
+    size_t from;                       // Primul indice inserat de fir
+    size_t to;                         // Indicele de după ultimul
+} InsertJob;
+
+static void * insert_thread(void * argument) {
+    InsertJob * job = (InsertJob *)argument;
+
+    for (size_t i = job->from; i < job->to; i++) {
+        if (job->olc) {
+            olc_insert(job->olc, job->keys[i], "", "", 2000, 100, 1000);
+        } else {
+            concurrent_insert(job->concurrent, job->keys[i], "", "", 2000, 100, 1000);
+        }
+    }
+    return NULL;
+}
+
+static double run(OlcTree * olc, ConcurrentTree * concurrent, const int * keys, size_t n, int threads) {
+    pthread_t ids[threads];
+    InsertJob jobs[threads];
+
+    double start = bench_now();
+    for (int t = 0; t < threads; t++) {
+        jobs[t] = (InsertJob){ olc, concurrent, keys, n * t / threads, n * (t + 1) / threads };
+        pthread_create(&ids[t], NULL, insert_thread, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    return (double)n / (bench_now() - start) / 1e6;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    int max_threads = (int)bench_arg(argc, argv, 2, 8);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    printf("n = %zu, %ld procesoare\n", n, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("  fire   zavor global   OLC (milioane inserari/s)\n");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        ConcurrentTree * concurrent = create_concurrent_tree(TREE_UNBALANCED);
+        double locked = run(NULL, concurrent, keys, n, threads);
+        free_concurrent_tree(concurrent);
+
+        OlcTree * olc = create_olc_tree();
+        double optimistic = run(olc, NULL, keys, n, threads);
+        for (size_t i = 0; i < n; i += n / 1000 + 1) {
+            if (!olc_get(olc, keys[i])) {
+                printf("eroare OLC\n");
+                return 1;
+            }
+        }
+        free_olc_tree(olc);
+
+        printf("  %4d   %12.2f   %12.2f\n", threads, locked, optimistic);
+    }
+
+    free(keys);
+    return 0;
+}
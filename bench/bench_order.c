@@ -0,0 +1,97 @@
+/**
+ * Benchmark: statistici de ordine (tree_select/tree_rank) și costul lor la inserare
+ * Utilizare: bench_order [n] [interogări]   (implicit 1000000 100000)
+ *
+ * Fără dimensiuni în noduri, a k-a cheie se obține cu iteratorul (k pași), iar
+ * rangul cu range_count() parcurgând toate cheile mai mici.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "binary_tree.h"
+#include "tree_iterator.h"
+#include "bench_common.h"
+
+/* Interogările fără dimensiuni costă O(n), deci se măsoară doar câteva */
+#define SLOW_QUERIES 50
+
+static BinaryTree * build(TreeBalanceMode mode, const int * keys, size_t n, bool order_statistics, double * elapsed) {
+    BinaryTree * tree = create_tree(mode);
+    if (order_statistics) enable_order_statistics(tree);
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    *elapsed = bench_now() - start;
+    return tree;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t queries = bench_arg(argc, argv, 2, 100000);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    printf("n = %zu\n", n);
+    TreeBalanceMode modes[] = { TREE_AVL, TREE_RED_BLACK };
+    const char * names[] = { "AVL", "rosu-negru" };
+    for (int m = 0; m < 2; m++) {
+        double plain, augmented;
+        free_tree(build(modes[m], keys, n, false, &plain));
+        free_tree(build(modes[m], keys, n, true, &augmented));
+        printf("  inserare %-10s fara dimensiuni %.3f s, cu dimensiuni %.3f s (+%.0f%%)\n",
+               names[m], plain, augmented, (augmented / plain - 1.0) * 100.0);
+    }
+
+    double unused;
+    BinaryTree * plain_tree = build(TREE_AVL, keys, n, false, &unused);
+    BinaryTree * tree = build(TREE_AVL, keys, n, true, &unused);
+    free(keys);
+
+    uint64_t seed = 11;
+    size_t * positions = (size_t *)malloc(queries * sizeof(size_t));
+    for (size_t i = 0; i < queries; i++) positions[i] = (size_t)(bench_rand(&seed) % n);
+
+    // Cheile sunt 0..n-1, deci a k-a cheie este chiar k, iar rangul cheii k este k
+    double start = bench_now();
+    for (size_t i = 0; i < queries; i++) {
+        BinaryTreeNode * node = tree_select(tree, positions[i]);
+        if (!node || (size_t)node->key != positions[i]) { printf("eroare select\n"); return 1; }
+    }
+    double select = (bench_now() - start) / (double)queries;
+
+    start = bench_now();
+    for (size_t i = 0; i < queries; i++) {
+        if (tree_rank(tree, (int)positions[i]) != positions[i]) { printf("eroare rank\n"); return 1; }
+    }
+    double rank = (bench_now() - start) / (double)queries;
+
+    TreeIterator * iterator = create_tree_iterator(plain_tree);
+    start = bench_now();
+    for (size_t i = 0; i < SLOW_QUERIES; i++) {
+        BinaryTreeNode * node = tree_iterator_first(iterator);
+        for (size_t step = 0; step < positions[i]; step++) node = tree_iterator_next(iterator);
+        if ((size_t)node->key != positions[i]) { printf("eroare iterator\n"); return 1; }
+    }
+    double slow_select = (bench_now() - start) / SLOW_QUERIES;
+    free_tree_iterator(iterator);
+
+    start = bench_now();
+    for (size_t i = 0; i < SLOW_QUERIES; i++) {
+        if (range_count(plain_tree, INT_MIN, (int)positions[i] - 1) != positions[i]) { printf("eroare range\n"); return 1; }
+    }
+    double slow_rank = (bench_now() - start) / SLOW_QUERIES;
+
+    start = bench_now();
+    size_t total = 0;
+    for (size_t i = 0; i < queries; i++) total += range_count(tree, (int)positions[i], (int)positions[i] + 9999);
+    double fast_count = (bench_now() - start) / (double)queries;
+
+    printf("  tree_select: %8.0f ns   (iterator, k pasi: %10.0f ns, %.0fx)\n", select * 1e9, slow_select * 1e9, slow_select / select);
+    printf("  tree_rank:   %8.0f ns   (range_count parcurs: %6.0f ns, %.0fx)\n", rank * 1e9, slow_rank * 1e9, slow_rank / rank);
+    printf("  range_count pe 10000 de chei cu dimensiuni: %.0f ns (medie %zu chei)\n", fast_count * 1e9, total / queries);
+
+    free(positions);
+    free_tree(plain_tree);
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,155 @@
+/**
+ * Benchmark: latența căutărilor (p50/p99/max) în timp ce un scriitor modifică și rebalansează arborele
+ * Zăvor cititori-scriitor (ConcurrentTree) vs. arbore persistent cu reclamare pe epoci
+ * Arborele cu zăvor este nebalansat: balance_tree() nu face nimic pentru un arbore AVL,
+ * iar aici trebuie măsurată tocmai reconstruirea completă.
+ * Utilizare: bench_persistent [n] [cititori] [secunde]   (implicit 200000 3 2)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "binary_tree.h"
+#include "concurrent_tree.h"
+#include "persistent_tree.h"
+#include "bench_common.h"
+
+/* Numărul maxim de latențe păstrate de un cititor */
+#define MAX_SAMPLES 1000000
+
+/* Scriitorul rebalansează tot arborele după atâtea modificări */
+#define BALANCE_EVERY 20000
+
+typedef struct Workload {
+    ConcurrentTree * concurrent;       // Arborele cu zăvor (sau NULL)
+    PersistentTree * persistent;       // Arborele persistent (sau NULL)
+    size_t n;                          // Cheile sunt 0..n-1
+    atomic_bool stop;                  // Semnalul de oprire pentru toate firele
+} Workload;
+
+typedef struct Reader {
+    Workload * workload;
+    uint64_t seed;
+    double * samples;                  // Latențele măsurate, în secunde
+    size_t count;
+} Reader;
+
+static void * reader_thread(void * argument) {
+    Reader * reader = (Reader *)argument;
+    Workload * workload = reader->workload;
+    int slot = workload->persistent ? persistent_register_reader(workload->persistent) : NOT_FOUND_READER;
+    Book book;
+
+    while (!atomic_load(&workload->stop) && reader->count < MAX_SAMPLES) {
+        int key = (int)(bench_rand(&reader->seed) % workload->n);
+        double start = bench_now();
+        if (workload->persistent) {
+            persistent_get(workload->persistent, slot, key, &book);
+        } else {
+            concurrent_get(workload->concurrent, key, &book, NULL);
+        }
+        reader->samples[reader->count++] = bench_now() - start;
+    }
+
+    if (workload->persistent) persistent_unregister_reader(workload->persistent, slot);
+    return NULL;
+}
+
+static void * writer_thread(void * argument) {
+    Workload * workload = (Workload *)argument;
+    uint64_t seed = 77;
+    size_t operations = 0;
+
+    while (!atomic_load(&workload->stop)) {
+        // Șterge și reinserează o cheie, ca dimensiunea arborelui să rămână constantă
+        int key = (int)(bench_rand(&seed) % workload->n);
+        if (workload->persistent) {
+            persistent_delete(workload->persistent, key);
+            persistent_insert(workload->persistent, key, "", "", 2000, 100, 1000);
+        } else {
+            concurrent_delete(workload->concurrent, key);
+            concurrent_insert(workload->concurrent, key, "", "", 2000, 100, 1000);
+        }
+
+        if (++operations % BALANCE_EVERY == 0) {
+            if (workload->persistent) persistent_balance(workload->persistent);
+            else concurrent_balance(workload->concurrent);
+        }
+    }
+    return NULL;
+}
+
+static int compare_samples(const void * a, const void * b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void run(const char * name, Workload * workload, int readers, double seconds) {
+    Reader * jobs = (Reader *)malloc(readers * sizeof(Reader));
+    pthread_t * ids = (pthread_t *)malloc(readers * sizeof(pthread_t));
+    pthread_t writer;
+
+    atomic_store(&workload->stop, false);
+    for (int i = 0; i < readers; i++) {
+        jobs[i] = (Reader){ workload, 0x9E3779B97F4A7C15ULL * (uint64_t)(i + 1),
+                            (double *)malloc(MAX_SAMPLES * sizeof(double)), 0 };
+        pthread_create(&ids[i], NULL, reader_thread, &jobs[i]);
+    }
+    pthread_create(&writer, NULL, writer_thread, workload);
+
+    double start = bench_now();
+    while (bench_now() - start < seconds) {
+        struct timespec pause = { 0, 10000000 };
+        nanosleep(&pause, NULL);
+    }
+    atomic_store(&workload->stop, true);
+    pthread_join(writer, NULL);
+
+    // Toate latențele la un loc
+    size_t total = 0;
+    for (int i = 0; i < readers; i++) {
+        pthread_join(ids[i], NULL);
+        total += jobs[i].count;
+    }
+    double * all = (double *)malloc((total ? total : 1) * sizeof(double));
+    size_t offset = 0;
+    for (int i = 0; i < readers; i++) {
+        for (size_t j = 0; j < jobs[i].count; j++) all[offset++] = jobs[i].samples[j];
+        free(jobs[i].samples);
+    }
+    qsort(all, total, sizeof(double), compare_samples);
+
+    if (total > 0) {
+        printf("  %-22s %9zu cautari  p50 %8.2f us  p99 %10.2f us  max %10.2f us\n", name, total,
+               all[total / 2] * 1e6, all[total * 99 / 100] * 1e6, all[total - 1] * 1e6);
+    }
+
+    free(all);
+    free(ids);
+    free(jobs);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 200000);
+    int readers = (int)bench_arg(argc, argv, 2, 3);
+    double seconds = (double)bench_arg(argc, argv, 3, 2);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    printf("n = %zu, %d cititori + 1 scriitor (balansare la %d modificari), %.0f s\n",
+           n, readers, BALANCE_EVERY, seconds);
+
+    Workload locked = { .concurrent = create_concurrent_tree(TREE_UNBALANCED), .persistent = NULL, .n = n };
+    for (size_t i = 0; i < n; i++) concurrent_insert(locked.concurrent, keys[i], "", "", 2000, 100, 1000);
+    run("zavor cititori-scriitor", &locked, readers, seconds);
+    free_concurrent_tree(locked.concurrent);
+
+    Workload persistent = { .concurrent = NULL, .persistent = create_persistent_tree(), .n = n };
+    for (size_t i = 0; i < n; i++) persistent_insert(persistent.persistent, keys[i], "", "", 2000, 100, 1000);
+    run("arbore persistent", &persistent, readers, seconds);
+    free_persistent_tree(persistent.persistent);
+
+    free(keys);
+    return 0;
+}
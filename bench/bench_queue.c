@@ -0,0 +1,113 @@
+/**
+ * Benchmark: parcurgerea în lățime cu coada înlănțuită veche vs. coada circulară
+ * Utilizare: bench_queue [n1 n2 ...]   (implicit 1000000 10000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/* Peste această dimensiune coada veche (O(n²)) nu mai este măsurată */
+#define LEGACY_LIMIT 100000
+
+/**
+ * Coada înlănțuită din versiunea inițială, păstrată doar pentru comparație:
+ * fiecare inserare parcurge coada până la ultimul element și face un malloc.
+ */
+typedef struct LegacyQueueNode {
+    BinaryTreeNode * tree_node;
+    struct LegacyQueueNode * next;
+} LegacyQueueNode;
+
+typedef struct LegacyQueue {
+    LegacyQueueNode * head;
+    int size;
+} LegacyQueue;
+
+static void legacy_enqueue(LegacyQueue * queue, BinaryTreeNode * tree_node) {
+    LegacyQueueNode * new_node = (LegacyQueueNode *)malloc(sizeof(LegacyQueueNode));
+    new_node->tree_node = tree_node;
+    new_node->next = NULL;
+    queue->size++;
+
+    if (!queue->head) {
+        queue->head = new_node;
+        return;
+    }
+
+    LegacyQueueNode * head = queue->head;
+    while (head->next) head = head->next;
+    head->next = new_node;
+}
+
+static BinaryTreeNode * legacy_dequeue(LegacyQueue * queue) {
+    LegacyQueueNode * head = queue->head;
+    queue->size--;
+    queue->head = head->next;
+    BinaryTreeNode * tree_node = head->tree_node;
+    free(head);
+    return tree_node;
+}
+
+static int legacy_get_tree_depth(BinaryTree * tree) {
+    LegacyQueue queue = { NULL, 0 };
+    legacy_enqueue(&queue, tree->root);
+
+    int depth = NOT_FOUND_DEPTH;
+    while (queue.head) {
+        int level_nodes_count = queue.size;
+        for (int i = 0; i < level_nodes_count; i++) {
+            BinaryTreeNode * current_tree_node = legacy_dequeue(&queue);
+            if (current_tree_node->left) legacy_enqueue(&queue, current_tree_node->left);
+            if (current_tree_node->right) legacy_enqueue(&queue, current_tree_node->right);
+        }
+        depth++;
+    }
+    return depth;
+}
+
+static void run(size_t n) {
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_UNBALANCED);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    }
+    free(keys);
+
+    printf("n = %zu\n", n);
+
+    if (n <= LEGACY_LIMIT) {
+        double start = bench_now();
+        int depth = legacy_get_tree_depth(tree);
+        printf("  coada inlantuita:  depth=%d  %.3f s\n", depth, bench_now() - start);
+    } else {
+        printf("  coada inlantuita:  omis (O(n^2), n > %d)\n", LEGACY_LIMIT);
+    }
+
+    // Primul apel alocă tabloul cozii, al doilea îl refolosește
+    double start = bench_now();
+    int depth = get_tree_depth(tree);
+    double first = bench_now() - start;
+    start = bench_now();
+    get_tree_depth(tree);
+    double second = bench_now() - start;
+    printf("  coada circulara:   depth=%d  %.3f s (apel repetat %.3f s)\n", depth, first, second);
+
+    start = bench_now();
+    clear_tree(tree);
+    printf("  clear_tree:        %.3f s\n", bench_now() - start);
+
+    free_tree(tree);
+}
+
+int main(int argc, char ** argv) {
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) run(bench_arg(argc, argv, i, 0));
+    } else {
+        run(1000000);
+        run(10000000);
+    }
+    return 0;
+}
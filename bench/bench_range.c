@@ -0,0 +1,90 @@
+/**
+ * Benchmark: range_query()/range_count() vs. parcurgerea SVD completă cu filtrare
+ * Utilizare: bench_range [n] [interogări]   (implicit 1000000 2000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+typedef struct {
+    int lo;
+    int hi;
+    size_t count;
+    long long total;
+} RangeContext;
+
+static bool filter_range(BinaryTreeNode * tree_node, void * context) {
+    RangeContext * range = (RangeContext *)context;
+    if (tree_node->key >= range->lo && tree_node->key <= range->hi) {
+        range->count++;
+        range->total += tree_node->book->quantity_sold;
+    }
+    return true;
+}
+
+static bool sum_range(BinaryTreeNode * tree_node, void * context) {
+    RangeContext * range = (RangeContext *)context;
+    range->count++;
+    range->total += tree_node->book->quantity_sold;
+    return true;
+}
+
+static void run(BinaryTree * tree, size_t n, size_t queries, int width) {
+    int * lo = (int *)malloc(queries * sizeof(int));
+    uint64_t seed = 17;
+    for (size_t i = 0; i < queries; i++) lo[i] = (int)(bench_rand(&seed) % n);
+
+    size_t scans = queries < 20 ? queries : 20;
+    RangeContext * expected = (RangeContext *)malloc(scans * sizeof(RangeContext));
+    double start = bench_now();
+    for (size_t i = 0; i < scans; i++) {
+        expected[i] = (RangeContext){ lo[i], lo[i] + width - 1, 0, 0 };
+        traverse_tree(tree, TRAVERSAL_SVD, filter_range, &expected[i]);
+    }
+    double scan = (bench_now() - start) / (double)scans;
+
+    start = bench_now();
+    for (size_t i = 0; i < queries; i++) {
+        RangeContext range = { lo[i], lo[i] + width - 1, 0, 0 };
+        range_query(tree, range.lo, range.hi, sum_range, &range);
+        if (i < scans && (range.count != expected[i].count || range.total != expected[i].total)) {
+            printf("eroare la interogarea %zu\n", i);
+            exit(1);
+        }
+    }
+    double query = (bench_now() - start) / (double)queries;
+
+    start = bench_now();
+    size_t counted = 0;
+    for (size_t i = 0; i < queries; i++) counted += range_count(tree, lo[i], lo[i] + width - 1);
+    double count = (bench_now() - start) / (double)queries;
+
+    printf("  latime %7d: SVD complet %9.1f us   range_query %8.2f us (%.0fx)   range_count %8.2f us (medie %zu chei)\n",
+           width, scan * 1e6, query * 1e6, scan / query, count * 1e6, counted / queries);
+
+    free(expected);
+    free(lo);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t queries = bench_arg(argc, argv, 2, 2000);
+
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_AVL);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, keys[i] % 1000));
+    }
+    free(keys);
+
+    printf("n = %zu (AVL), %zu intervale aleatoare\n", n, queries);
+    run(tree, n, queries, 10);
+    run(tree, n, queries, 1000);
+    run(tree, n, queries, 100000);
+
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * Benchmark: debitul inserărilor pentru arborele simplu, AVL și roșu-negru
+ * Utilizare: bench_rb [n]   (implicit 1000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "rb_tree.h"
+#include "bench_common.h"
+
+/**
+ * Verifică proprietățile roșu-negru și ordinea cheilor
+ * @return Înălțimea neagră a subarborelui sau -1 dacă proprietățile nu sunt respectate
+ */
+static int rb_check(BinaryTreeNode * tree_node, long low, long high) {
+    if (!tree_node) return 1;
+    int key = tree_node->key;
+    if (key < low || key > high) return -1;
+    if (tree_node->color == NODE_RED &&
+        ((tree_node->left && tree_node->left->color == NODE_RED) ||
+         (tree_node->right && tree_node->right->color == NODE_RED))) return -1;
+
+    int left = rb_check(tree_node->left, low, (long)key);
+    int right = rb_check(tree_node->right, (long)key, high);
+    if (left == -1 || right == -1 || left != right) return -1;
+    return left + (tree_node->color == NODE_BLACK);
+}
+
+static BinaryTree * build(TreeBalanceMode mode, int * keys, size_t n, double * seconds) {
+    BinaryTree * tree = create_tree(mode);
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    }
+    *seconds = bench_now() - start;
+    return tree;
+}
+
+static void run(const char * label, TreeBalanceMode mode, int * keys, size_t n) {
+    double seconds;
+    BinaryTree * tree = build(mode, keys, n, &seconds);
+    printf("  %-8s insert %.3f s  (%.2f M inserari/s)  depth=%d\n",
+           label, seconds, (double)n / seconds / 1e6, get_tree_depth(tree));
+    free_tree(tree);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+
+    int * shuffled = bench_shuffled_keys(n, 42);
+    int * sorted = (int *)malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)i;
+
+    printf("n = %zu\n", n);
+    printf(" chei aleatoare:\n");
+    run("simplu", TREE_UNBALANCED, shuffled, n);
+    run("AVL", TREE_AVL, shuffled, n);
+    run("RB", TREE_RED_BLACK, shuffled, n);
+    printf(" chei sortate (arborele simplu este omis, O(n^2)):\n");
+    run("AVL", TREE_AVL, sorted, n);
+    run("RB", TREE_RED_BLACK, sorted, n);
+
+    // Ștergeri în ordine aleatoare, cu verificarea proprietăților la jumătate și la final
+    double seconds;
+    BinaryTree * tree = build(TREE_RED_BLACK, sorted, n, &seconds);
+    int * order = bench_shuffled_keys(n, 99);
+    size_t deleted = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < n / 2; i++) deleted += rb_delete(tree, order[i]);
+    double delete_time = bench_now() - start;
+    int valid_half = rb_check(tree->root, -1L, (long)n) != -1;
+    for (size_t i = n / 2; i < n; i++) deleted += rb_delete(tree, order[i]);
+    printf(" RB delete: %zu chei in %.3f s pentru prima jumatate, valid=%s, arbore gol=%s\n",
+           deleted, delete_time, valid_half ? "da" : "nu", tree->root ? "nu" : "da");
+
+    free_tree(tree);
+    free(order);
+    free(sorted);
+    free(shuffled);
+    return 0;
+}
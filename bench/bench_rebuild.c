@@ -0,0 +1,148 @@
+/**
+ * Benchmark: balance_tree() cu liste alocate vs. reconstruirea pe loc
+ * Utilizare: bench_rebuild [n1 n2 ...]   (implicit 1000000 10000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/* Peste această dimensiune varianta cu liste (O(n log n), un malloc per nod) nu mai este măsurată */
+#ifndef LEGACY_LIMIT
+#define LEGACY_LIMIT 1000000
+#endif
+
+/**
+ * Varianta inițială, păstrată doar pentru comparație: câte un ListNode per nod,
+ * mijlocul fiecărei subliste găsit cu pointeri lent/rapid și liste nealocate
+ * niciodată. Pentru subliste cu două elemente pierde al doilea nod, așa că
+ * arborele rezultat este folosit doar pentru măsurarea timpului.
+ */
+static ListNode * legacy_get_list_center(List * list) {
+    if (is_list_empty(list)) return NULL;
+
+    ListNode * slow = list->head;
+    ListNode * fast = list->head;
+    while (fast && fast->next) {
+        slow = slow->next;
+        fast = fast->next->next;
+    }
+    return slow;
+}
+
+static ListNode * legacy_get_balanced_tree_root(List * main_list) {
+    ListNode * head = main_list->head;
+    ListNode * tail = main_list->tail;
+
+    ListNode * center = legacy_get_list_center(main_list);
+    center->tree_node->left = NULL;
+    center->tree_node->right = NULL;
+
+    if (center == head || center == tail) return head;
+
+    List * left_list = create_list();
+    left_list->head = head;
+    left_list->tail = center->prev;
+    if (left_list->tail) left_list->tail->next = NULL;
+    if (left_list->head) left_list->head->prev = NULL;
+
+    List * right_list = create_list();
+    right_list->head = center->next;
+    right_list->tail = tail;
+    if (right_list->head) right_list->head->prev = NULL;
+    if (right_list->tail) right_list->tail->next = NULL;
+
+    ListNode * left = legacy_get_balanced_tree_root(left_list);
+    ListNode * right = legacy_get_balanced_tree_root(right_list);
+
+    center->tree_node->left = left->tree_node;
+    center->tree_node->right = right->tree_node;
+
+    free(left_list);
+    free(right_list);
+
+    return center;
+}
+
+static void legacy_balance_tree(BinaryTree * tree) {
+    List * tree_nodes_list = get_tree_nodes_list(tree);
+
+    // Varianta veche rupe lista în bucăți, deci nodurile listei sunt salvate înainte ca să poată fi eliberate
+    ListNode ** list_nodes = (ListNode **)malloc(tree->node_count * sizeof(ListNode *));
+    size_t count = 0;
+    for (ListNode * list_node = tree_nodes_list->head; list_node; list_node = list_node->next) list_nodes[count++] = list_node;
+
+    tree->root = legacy_get_balanced_tree_root(tree_nodes_list)->tree_node;
+
+    for (size_t i = 0; i < count; i++) free(list_nodes[i]);
+    free(list_nodes);
+    free(tree_nodes_list);
+}
+
+static BinaryTree * build_random_tree(size_t n) {
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_UNBALANCED);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+    }
+    free(keys);
+    return tree;
+}
+
+static void run(size_t n) {
+    printf("n = %zu\n", n);
+
+    if (n <= LEGACY_LIMIT) {
+        BinaryTree * tree = build_random_tree(n);
+        double start = bench_now();
+        legacy_balance_tree(tree);
+        printf("  liste alocate:     %.3f s (%zu octeti de ListNode)\n",
+               bench_now() - start, n * sizeof(ListNode));
+        free_tree(tree);
+    } else {
+        printf("  liste alocate:     omis (n > %d)\n", LEGACY_LIMIT);
+    }
+
+    BinaryTree * tree = build_random_tree(n);
+    int depth_before = get_tree_depth(tree);
+    double start = bench_now();
+    balance_tree(tree);
+    double elapsed = bench_now() - start;
+    printf("  reconstruire:      %.3f s (adancime %d -> %d, balansat: %s)\n",
+           elapsed, depth_before, get_tree_depth(tree), is_tree_balanced(tree) ? "da" : "nu");
+
+    // Toate cheile trebuie să fie încă găsite
+    for (size_t key = 0; key < n; key++) {
+        if (!get(tree, (int)key)) {
+            printf("eroare: lipseste cheia %zu\n", key);
+            exit(1);
+        }
+    }
+    free_tree(tree);
+
+    // Cazul cel mai rău pentru vechiul cod: cheile inserate în ordine (arbore degenerat)
+    tree = create_tree(TREE_UNBALANCED);
+    BinaryTreeNode * last = NULL;
+    for (size_t i = 0; i < n; i++) {
+        BinaryTreeNode * node = create_tree_node(tree, create_book(tree, (int)i, "", "", 2000, 100, 1000));
+        if (last) last->right = node; else tree->root = node;
+        last = node;
+    }
+    start = bench_now();
+    balance_tree(tree);
+    printf("  lista degenerata:  %.3f s (adancime %zu -> %d)\n",
+           bench_now() - start, n - 1, get_tree_depth(tree));
+    free_tree(tree);
+}
+
+int main(int argc, char ** argv) {
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) run(bench_arg(argc, argv, i, 0));
+    } else {
+        run(1000000);
+        run(10000000);
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * Benchmark: get() vs. Eytzinger vs. S-tree (cereri individuale și în loturi)
+ * Utilizare: bench_s_tree [n] [lookups]   (implicit 10000000 10000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "frozen_tree.h"
+#include "s_tree.h"
+#include "bench_common.h"
+
+static void report(const char * label, double seconds, size_t lookups, double baseline) {
+    printf("  %-26s %7.1f ns/op  %7.2f M cereri/s  (%.2fx fata de get)\n", label,
+           seconds * 1e9 / (double)lookups, (double)lookups / seconds / 1e6, baseline / seconds);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 10000000);
+    size_t lookups = bench_arg(argc, argv, 2, 10000000);
+
+    // Chei pare, inserate în ordine aleatoare
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_AVL);
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, 2 * keys[i], "", "", 2000, 100, 1000));
+    }
+    free(keys);
+
+    double start = bench_now();
+    STree * s_tree = build_s_tree(tree);
+    double build_time = bench_now() - start;
+    FrozenTree * frozen = freeze_tree(tree);
+    printf("n = %zu, lookups = %zu, varianta SIMD: %s, build_s_tree %.3f s\n",
+           n, lookups, s_tree_simd_name(), build_time);
+
+    uint64_t seed = 21;
+    int * queries = (int *)malloc(lookups * sizeof(int));
+    for (size_t i = 0; i < lookups; i++) queries[i] = (int)(bench_rand(&seed) % (2 * n + 1));
+    long * results = (long *)malloc(lookups * sizeof(long));
+
+    size_t found_get = 0, found_frozen = 0, found_s_tree = 0;
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) found_get += get(tree, queries[i]) != NULL;
+    double get_time = bench_now() - start;
+
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) found_frozen += frozen_get(frozen, queries[i]) != NULL;
+    double frozen_time = bench_now() - start;
+
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) found_s_tree += s_tree_get(s_tree, queries[i]) != NULL;
+    double s_tree_time = bench_now() - start;
+
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) results[i] = s_tree_lower_bound(s_tree, queries[i]);
+    double lower_bound_time = bench_now() - start;
+
+    start = bench_now();
+    s_tree_lower_bound_batch(s_tree, queries, lookups, results);
+    double batch_time = bench_now() - start;
+
+    // Verificare: lower_bound individual, în lot și din instantaneul Eytzinger coincid
+    if (found_get != found_frozen || found_get != found_s_tree) {
+        printf("  eroare: %zu / %zu / %zu chei gasite\n", found_get, found_frozen, found_s_tree);
+        return 1;
+    }
+    for (size_t i = 0; i < lookups; i++) {
+        if (results[i] != s_tree_lower_bound(s_tree, queries[i]) ||
+            results[i] != frozen_lower_bound(frozen, queries[i])) {
+            printf("  eroare la cererea %zu (cheia %d)\n", i, queries[i]);
+            return 1;
+        }
+    }
+
+    report("get():", get_time, lookups, get_time);
+    report("frozen_get():", frozen_time, lookups, get_time);
+    report("s_tree_get():", s_tree_time, lookups, get_time);
+    report("s_tree_lower_bound():", lower_bound_time, lookups, get_time);
+    report("s_tree_lower_bound_batch():", batch_time, lookups, get_time);
+    printf("  (%zu chei gasite din %zu)\n", found_get, lookups);
+
+    free(results);
+    free(queries);
+    free_frozen_tree(frozen);
+    free_s_tree(s_tree);
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * Benchmark: latența inserărilor (p50/p99/p99.9) pentru chei sortate și aleatoare
+ * Utilizare: bench_scapegoat [n]   (implicit 200000)
+ *
+ * Se compară arborele scapegoat cu AVL, roșu-negru și cu arborele simplu
+ * balansat periodic cu balance_tree() (câte o reconstruire completă la fiecare
+ * PERIODIC_REBUILD inserări).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+#define PERIODIC_REBUILD 2048
+
+typedef struct {
+    const char * name;
+    TreeBalanceMode mode;
+    bool periodic;
+} Variant;
+
+static int compare_doubles(const void * a, const void * b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void run(const Variant * variant, const int * keys, size_t n, double * latencies) {
+    BinaryTree * tree = create_tree(variant->mode);
+
+    double begin = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        double start = bench_now();
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, 1000));
+        if (variant->periodic && (i + 1) % PERIODIC_REBUILD == 0 && !is_tree_balanced(tree)) {
+            tree->root = rebuild_subtree(tree->root);
+        }
+        latencies[i] = bench_now() - start;
+    }
+    double total = bench_now() - begin;
+
+    int depth = get_tree_depth(tree);
+    qsort(latencies, n, sizeof(double), compare_doubles);
+    printf("  %-26s total %6.3f s  p50 %6.0f ns  p99 %8.0f ns  p99.9 %10.0f ns  max %10.0f ns  adancime %d\n",
+           variant->name, total, latencies[n / 2] * 1e9, latencies[n * 99 / 100] * 1e9,
+           latencies[n * 999 / 1000] * 1e9, latencies[n - 1] * 1e9, depth);
+
+    free_tree(tree);
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 200000);
+    double * latencies = (double *)malloc(n * sizeof(double));
+    Variant variants[] = {
+        { "scapegoat", TREE_SCAPEGOAT, false },
+        { "AVL", TREE_AVL, false },
+        { "rosu-negru", TREE_RED_BLACK, false },
+        { "simplu + balance periodic", TREE_UNBALANCED, true },
+    };
+    int variant_count = (int)(sizeof(variants) / sizeof(variants[0]));
+
+    int * sorted = (int *)malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)i;
+    int * shuffled = bench_shuffled_keys(n, 42);
+
+    printf("n = %zu, chei sortate:\n", n);
+    for (int v = 0; v < variant_count; v++) run(&variants[v], sorted, n, latencies);
+
+    printf("n = %zu, chei aleatoare:\n", n);
+    for (int v = 0; v < variant_count; v++) run(&variants[v], shuffled, n, latencies);
+
+    free(sorted);
+    free(shuffled);
+    free(latencies);
+    return 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * Benchmark: căutări și inserări amestecate de la 1 la N fire, arbore împărțit vs. zăvor global,
+ * apoi rebalansarea partițiilor după inserări concentrate la capătul intervalului, cu
+ * cititori care rulează în timpul ei (debit și latența maximă, comparate cu aceiași
+ * cititori fără rebalansare)
+ * Utilizare: bench_sharded [n] [fire maxime] [operații pe fir] [partiții]   (implicit 1000000 8 1000000 8;
+ * compilat cu sanitizatoare, implicit 20000 2 20000 4)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "binary_tree.h"
+#include "concurrent_tree.h"
+#include "sharded_tree.h"
+#include "bench_common.h"
+
+typedef struct MixedJob {
+    ShardedTree * sharded;             // Arborele împărțit (sau NULL)
+    ConcurrentTree * concurrent;       // Arborele cu zăvor global (sau NULL)
+    size_t n;                          // Cheile inițiale sunt 0, 2, ..., 2n - 2
+    size_t operations;                 // Numărul de operații ale firului
+    uint64_t seed;                     // Sămânța firului
+    size_t found;                      // Rezultat, ca bucla să nu fie eliminată
+} MixedJob;
+
+static void * mixed_thread(void * argument) {
+    MixedJob * job = (MixedJob *)argument;
+    uint64_t seed = job->seed;
+    size_t found = 0;
+
+    for (size_t i = 0; i < job->operations; i++) {
+        uint64_t random = bench_rand(&seed);
+        int key = (int)(random % (2 * job->n));
+        if (random % 10 == 0) {
+            // 10% inserări, cu chei noi (impare) răspândite peste tot intervalul
+            key |= 1;
+            if (job->sharded) sharded_insert(job->sharded, key, "", "", 2000, 100, 1000);
+            else concurrent_insert(job->concurrent, key, "", "", 2000, 100, 1000);
+        } else if (job->sharded) {
+            found += sharded_get(job->sharded, key, NULL, NULL, NULL);
+        } else {
+            found += concurrent_get(job->concurrent, key, NULL, NULL);
+        }
+    }
+
+    job->found = found;
+    return NULL;
+}
+
+static double run(ShardedTree * sharded, ConcurrentTree * concurrent, size_t n, int threads, size_t operations) {
+    pthread_t ids[threads];
+    MixedJob jobs[threads];
+
+    double start = bench_now();
+    for (int t = 0; t < threads; t++) {
+        jobs[t] = (MixedJob){ sharded, concurrent, n, operations, 0x9E3779B97F4A7C15ULL * (t + 1), 0 };
+        pthread_create(&ids[t], NULL, mixed_thread, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    return (double)operations * threads / (bench_now() - start) / 1e6;
+}
+
+typedef struct ReaderJob {
+    ShardedTree * sharded;             // Arborele citit
+    size_t n;                          // Cheile sunt în [0, 4n)
+    uint64_t seed;                     // Sămânța firului
+    atomic_bool * stop;                // Semnalul de oprire
+    size_t operations;                 // Rezultat: numărul de citiri
+    double max_latency;                // Rezultat: cea mai lungă citire (secunde)
+    size_t found;                      // Rezultat, ca bucla să nu fie eliminată
+} ReaderJob;
+
+static bool count_visit(BinaryTreeNode * tree_node, void * context) {
+    (void)tree_node;
+    (*(size_t *)context)++;
+    return true;
+}
+
+/* Căutări, plus 1% interogări pe intervale scurte, cu stiva proprie a firului */
+static void * reader_thread(void * argument) {
+    ReaderJob * job = (ReaderJob *)argument;
+    Stack * stack = create_stack();
+    uint64_t seed = job->seed;
+    size_t operations = 0, found = 0;
+    double max_latency = 0.0;
+
+    while (!atomic_load_explicit(job->stop, memory_order_relaxed)) {
+        uint64_t random = bench_rand(&seed);
+        int key = (int)(random % (4 * job->n));
+        double start = bench_now();
+        if (random % 100 == 0) sharded_range_query_with(job->sharded, key, key + 100, count_visit, &found, stack);
+        else found += sharded_get(job->sharded, key, NULL, NULL, NULL);
+        double latency = bench_now() - start;
+        if (latency > max_latency) max_latency = latency;
+        operations++;
+    }
+
+    free_stack(stack);
+    job->operations = operations;
+    job->max_latency = max_latency;
+    job->found = found;
+    return NULL;
+}
+
+/**
+ * Rulează cititori cât timp firul principal rebalansează (sau doar așteaptă duration secunde)
+ * @return Durata rebalansării sau a așteptării, în secunde
+ */
+static double run_readers(ShardedTree * sharded, size_t n, int threads, bool rebalance, double duration,
+                          double * throughput, double * max_latency) {
+    pthread_t ids[threads];
+    ReaderJob jobs[threads];
+    atomic_bool stop = false;
+
+    for (int t = 0; t < threads; t++) {
+        jobs[t] = (ReaderJob){ sharded, n, 0xD1B54A32D192ED03ULL * (t + 1), &stop, 0, 0.0, 0 };
+        pthread_create(&ids[t], NULL, reader_thread, &jobs[t]);
+    }
+
+    double start = bench_now();
+    if (rebalance) {
+        sharded_rebalance(sharded);
+    } else {
+        struct timespec pause = { (time_t)duration, (long)((duration - (double)(time_t)duration) * 1e9) };
+        nanosleep(&pause, NULL);
+    }
+    double elapsed = bench_now() - start;
+    atomic_store(&stop, true);
+
+    size_t operations = 0;
+    *max_latency = 0.0;
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+        operations += jobs[t].operations;
+        if (jobs[t].max_latency > *max_latency) *max_latency = jobs[t].max_latency;
+    }
+    *throughput = (double)operations / elapsed / 1e6;
+    return elapsed;
+}
+
+static size_t largest_shard(ShardedTree * sharded) {
+    size_t largest = 0;
+    for (int i = 0; i < sharded->shard_count; i++) {
+        size_t count = sharded->shards[i].concurrent->tree->node_count;
+        if (count > largest) largest = count;
+    }
+    return largest;
+}
+
+int main(int argc, char ** argv) {
+    // Sub sanitizatoare (mai ales ThreadSanitizer) valorile obișnuite ar rula zeci de minute
+    size_t n = bench_arg(argc, argv, 1, BENCH_SANITIZED ? 20000 : 1000000);
+    int max_threads = (int)bench_arg(argc, argv, 2, BENCH_SANITIZED ? 2 : 8);
+    size_t operations = bench_arg(argc, argv, 3, BENCH_SANITIZED ? 20000 : 1000000);
+    int shard_count = (int)bench_arg(argc, argv, 4, BENCH_SANITIZED ? 4 : 8);
+    int * keys = bench_shuffled_keys(n, 42);
+    for (size_t i = 0; i < n; i++) keys[i] *= 2;
+
+    printf("n = %zu, %d partitii, %ld procesoare, 90%% cautari + 10%% inserari\n",
+           n, shard_count, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("  fire   zavor global   partitionat (milioane operatii/s)\n");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        ConcurrentTree * concurrent = create_concurrent_tree(TREE_AVL);
+        for (size_t i = 0; i < n; i++) concurrent_insert(concurrent, keys[i], "", "", 2000, 100, 1000);
+        double locked = run(NULL, concurrent, n, threads, operations);
+        free_concurrent_tree(concurrent);
+
+        ShardedTree * sharded = create_sharded_tree(TREE_AVL, shard_count, keys, n);
+        for (size_t i = 0; i < n; i++) sharded_insert(sharded, keys[i], "", "", 2000, 100, 1000);
+        double partitioned = run(sharded, NULL, n, threads, operations);
+        free_sharded_tree(sharded);
+
+        printf("  %4d   %12.2f   %12.2f\n", threads, locked, partitioned);
+    }
+
+    // Limitele vin din cheile 0..2n, apoi se inserează încă n chei peste 2n: toate ajung în ultima partiție
+    ShardedTree * sharded = create_sharded_tree(TREE_AVL, shard_count, keys, n);
+    for (size_t i = 0; i < n; i++) sharded_insert(sharded, keys[i], "", "", 2000, 100, 1000);
+    for (size_t i = 0; i < n; i++) sharded_insert(sharded, (int)(2 * n) + keys[i], "", "", 2000, 100, 1000);
+    size_t before = largest_shard(sharded);
+
+    // Cititorii rulează în timpul rebalansării: doar câte două partiții vecine sunt blocate odată
+    double rebalance_throughput, rebalance_latency, idle_throughput, idle_latency;
+    double elapsed = run_readers(sharded, n, max_threads, true, 0.0, &rebalance_throughput, &rebalance_latency);
+    run_readers(sharded, n, max_threads, false, elapsed, &idle_throughput, &idle_latency);
+
+    for (size_t i = 0; i < n; i += n / 1000 + 1) {
+        if (!sharded_get(sharded, keys[i], NULL, NULL, NULL) || !sharded_get(sharded, (int)(2 * n) + keys[i], NULL, NULL, NULL)) {
+            printf("eroare rebalansare\n");
+            return 1;
+        }
+    }
+    printf("rebalansare dupa %zu inserari concentrate: %.1f ms, cea mai mare partitie %zu -> %zu noduri\n",
+           n, elapsed * 1e3, before, largest_shard(sharded));
+    printf("  %d cititori in timpul rebalansarii: %.2f milioane citiri/s, latenta maxima %.0f us\n",
+           max_threads, rebalance_throughput, rebalance_latency * 1e6);
+    printf("  aceiasi cititori fara rebalansare:  %.2f milioane citiri/s, latenta maxima %.0f us\n",
+           idle_throughput, idle_latency * 1e6);
+    free_sharded_tree(sharded);
+
+    free(keys);
+    return 0;
+}
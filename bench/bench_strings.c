@@ -0,0 +1,81 @@
+/**
+ * Raport: memoria ocupată de cărți cu tablouri fixe vs. depozitul de șiruri
+ * Utilizare: bench_strings [n] [autori]   (implicit 1000000 20000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+/**
+ * Cartea din versiunea inițială, cu titlul și autorul în tablouri fixe
+ */
+typedef struct {
+    int key;
+    char title[MAX_TITLE_LENGTH];
+    char author[MAX_AUTHOR_LENGTH];
+    int pub_year;
+    int page_count;
+    int quantity_sold;
+} LegacyBook;
+
+static const char * words[] = {
+    "Moara", "cu", "noroc", "Ion", "Baltagul", "Enigma", "Otiliei", "Padurea", "Spanzuratilor",
+    "Ultima", "noapte", "de", "dragoste", "Scrinul", "Negru", "Amintiri", "din", "copilarie",
+    "Doua", "loturi", "Mara", "Adela", "Morometii", "Ciuleandra", "O", "scrisoare", "pierduta"
+};
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t author_count = bench_arg(argc, argv, 2, 20000);
+    size_t word_count = sizeof(words) / sizeof(words[0]);
+
+    BinaryTree * tree = create_tree(TREE_AVL);
+    uint64_t seed = 5;
+    size_t title_bytes = 0;
+    char title[MAX_TITLE_LENGTH];
+    char author[MAX_AUTHOR_LENGTH];
+
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        // Titluri de 1-4 cuvinte, autori aleși dintr-o mulțime limitată
+        title[0] = '\0';
+        int length = 1 + (int)(bench_rand(&seed) % 4);
+        for (int w = 0; w < length; w++) {
+            if (w) strcat(title, " ");
+            strcat(title, words[bench_rand(&seed) % word_count]);
+        }
+        snprintf(author, sizeof(author), "Autor %zu", (size_t)(bench_rand(&seed) % author_count));
+        title_bytes += strlen(title);
+
+        insert(tree, create_book(tree, (int)i, title, author, 1900, 200, 1000));
+    }
+    double load_time = bench_now() - start;
+
+    size_t legacy_bytes = n * sizeof(LegacyBook);
+    size_t book_bytes = tree->book_slab.reserved_bytes;
+    size_t string_bytes = tree->strings.reserved_bytes;
+    size_t table_bytes = tree->strings.table_capacity * sizeof(int) +
+                         (size_t)tree->strings.author_capacity * sizeof(char *);
+    size_t new_bytes = book_bytes + string_bytes + table_bytes;
+
+    printf("n = %zu carti, %d autori distincti, titlu mediu %.1f octeti, incarcare %.3f s\n",
+           n, tree->strings.author_count, (double)title_bytes / (double)n, load_time);
+    printf("  tablouri fixe:     %zu octeti/carte, total %.1f MB\n",
+           sizeof(LegacyBook), (double)legacy_bytes / 1048576.0);
+    printf("  depozit de siruri: %zu octeti/carte + siruri, total %.1f MB "
+           "(carti %.1f MB, siruri %.1f MB, tabele %.1f MB)\n",
+           sizeof(Book), (double)new_bytes / 1048576.0, (double)book_bytes / 1048576.0,
+           (double)string_bytes / 1048576.0, (double)table_bytes / 1048576.0);
+    printf("  reducere: %.1fx\n", (double)legacy_bytes / (double)new_bytes);
+
+    Book * book = get(tree, 0)->book;
+    printf("  exemplu: \"%s\" (%zu octeti) de %s\n",
+           book->title, string_pool_length(book->title), get_book_author(tree, book));
+
+    free_tree(tree);
+    return 0;
+}
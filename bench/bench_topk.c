@@ -0,0 +1,115 @@
+/**
+ * Benchmark: cele mai vândute k cărți prin indexul după tiraj vs. parcurgere cu heap limitat
+ * Utilizare: bench_topk [n] [k]   (implicit 1000000 50)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+#define QUERIES 1000
+#define SLOW_QUERIES 10
+
+/**
+ * Heap minim cu cel mult k cărți: rădăcina este cea mai slabă carte păstrată
+ */
+typedef struct BoundedHeap {
+    Book ** items;
+    size_t size;
+    size_t capacity;
+} BoundedHeap;
+
+static bool heap_less(const Book * a, const Book * b) {
+    if (a->quantity_sold != b->quantity_sold) return a->quantity_sold < b->quantity_sold;
+    return a->key < b->key;
+}
+
+static void heap_sift_down(BoundedHeap * heap, size_t index) {
+    while (true) {
+        size_t smallest = index;
+        size_t left = 2 * index + 1, right = left + 1;
+        if (left < heap->size && heap_less(heap->items[left], heap->items[smallest])) smallest = left;
+        if (right < heap->size && heap_less(heap->items[right], heap->items[smallest])) smallest = right;
+        if (smallest == index) return;
+        Book * temp = heap->items[index];
+        heap->items[index] = heap->items[smallest];
+        heap->items[smallest] = temp;
+        index = smallest;
+    }
+}
+
+static bool heap_offer(BinaryTreeNode * tree_node, void * context) {
+    BoundedHeap * heap = (BoundedHeap *)context;
+    Book * book = tree_node->book;
+
+    if (heap->size < heap->capacity) {
+        size_t index = heap->size++;
+        heap->items[index] = book;
+        while (index > 0 && heap_less(heap->items[index], heap->items[(index - 1) / 2])) {
+            Book * temp = heap->items[index];
+            heap->items[index] = heap->items[(index - 1) / 2];
+            heap->items[(index - 1) / 2] = temp;
+            index = (index - 1) / 2;
+        }
+    } else if (heap_less(heap->items[0], book)) {
+        heap->items[0] = book;
+        heap_sift_down(heap, 0);
+    }
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    size_t k = bench_arg(argc, argv, 2, 50);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    BinaryTree * tree = create_tree(TREE_AVL);
+    uint64_t seed = 21;
+    for (size_t i = 0; i < n; i++) {
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, (int)(bench_rand(&seed) % 1000000)));
+    }
+
+    double start = bench_now();
+    enable_sales_index(tree);
+    printf("n = %zu, k = %zu\n", n, k);
+    printf("  construire index:        %.3f s\n", bench_now() - start);
+
+    Book ** top = (Book **)malloc(k * sizeof(Book *));
+    BoundedHeap heap = { (Book **)malloc(k * sizeof(Book *)), 0, k };
+
+    start = bench_now();
+    for (size_t q = 0; q < QUERIES; q++) top_k(tree, k, top);
+    double fast = (bench_now() - start) / QUERIES;
+
+    start = bench_now();
+    for (size_t q = 0; q < SLOW_QUERIES; q++) {
+        heap.size = 0;
+        traverse_tree(tree, TRAVERSAL_SVD, heap_offer, &heap);
+    }
+    double slow = (bench_now() - start) / SLOW_QUERIES;
+
+    // Cea mai slabă carte din heap trebuie să fie ultima din top_k()
+    size_t found = top_k(tree, k, top);
+    if (found != heap.size || (found > 0 && top[found - 1] != heap.items[0])) {
+        printf("eroare top_k\n");
+        return 1;
+    }
+
+    printf("  top_k (index):           %.2f us\n", fast * 1e6);
+    printf("  parcurgere + heap de k:  %.2f ms (%.0fx mai lent)\n", slow * 1e3, slow / fast);
+
+    // Vânzările se schimbă: cartea este mutată în index
+    start = bench_now();
+    for (size_t i = 0; i < n / 10; i++) {
+        update_quantity(tree, keys[i], (int)(bench_rand(&seed) % 1000000));
+    }
+    printf("  update_quantity:         %.2f us\n", (bench_now() - start) / (double)(n / 10) * 1e6);
+
+    free(heap.items);
+    free(top);
+    free(keys);
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * Test de rezistență: parcurgerile în adâncime pe un arbore degenerat
+ * Utilizare: bench_traversal [n]   (implicit 10000000)
+ *
+ * Cheile 0..n-1 sunt legate într-un lanț spre dreapta, exact forma produsă de
+ * insert() pentru chei sortate (construit direct, ca să nu coste O(n²)).
+ * Variantele recursive depășeau stiva C după câteva sute de mii de noduri.
+ * Afișarea este redirecționată spre /dev/null pe durata măsurătorilor.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+static int saved_stdout = -1;
+
+static void silence_stdout(void) {
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void restore_stdout(void) {
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+}
+
+typedef void (*TreePrinter)(BinaryTree * tree);
+
+static double time_printer(TreePrinter printer, BinaryTree * tree) {
+    silence_stdout();
+    double start = bench_now();
+    printer(tree);
+    double elapsed = bench_now() - start;
+    restore_stdout();
+    return elapsed;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 10000000);
+
+    BinaryTree * tree = create_tree(TREE_UNBALANCED);
+    BinaryTreeNode * last = NULL;
+    for (size_t i = 0; i < n; i++) {
+        BinaryTreeNode * node = create_tree_node(tree, create_book(tree, (int)i, "", "", 2000, 100, 1000));
+        if (last) last->right = node; else tree->root = node;
+        last = node;
+    }
+    tree->node_count = n;
+
+    printf("lant degenerat spre dreapta, n = %zu\n", n);
+    printf("  SVD_trasversal:       %.3f s\n", time_printer(SVD_trasversal, tree));
+    printf("  VSD_trasversal:       %.3f s\n", time_printer(VSD_trasversal, tree));
+    printf("  SDV_trasversal:       %.3f s\n", time_printer(SDV_trasversal, tree));
+    printf("  DFS:                  %.3f s\n", time_printer(DFS, tree));
+
+    double start = bench_now();
+    List * list = get_tree_nodes_list(tree);
+    bool sorted = true;
+    int expected = 0;
+    for (ListNode * node = list->head; node; node = node->next) sorted &= node->tree_node->key == expected++;
+    free_list(list);
+    printf("  get_tree_nodes_list:  %.3f s (%s)\n", bench_now() - start, sorted && (size_t)expected == n ? "ordonata" : "EROARE");
+
+    start = bench_now();
+    bool balanced = is_tree_balanced(tree);
+    printf("  is_tree_balanced:     %.3f s (%s)\n", bench_now() - start, balanced ? "da" : "nu");
+
+    start = bench_now();
+    mirror_tree(tree);
+    printf("  mirror_tree:          %.3f s (lantul devine spre stanga)\n", bench_now() - start);
+    printf("  SVD pe lantul stang:  %.3f s\n", time_printer(SVD_trasversal, tree));
+    printf("  SDV pe lantul stang:  %.3f s\n", time_printer(SDV_trasversal, tree));
+    mirror_tree(tree);
+
+    start = bench_now();
+    balance_tree(tree);
+    printf("  balance_tree:         %.3f s (adancime %d)\n", bench_now() - start, get_tree_depth(tree));
+    printf("  SVD dupa balansare:   %.3f s\n", time_printer(SVD_trasversal, tree));
+
+    free_tree(tree);
+    return 0;
+}
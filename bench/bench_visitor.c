@@ -0,0 +1,90 @@
+/**
+ * Benchmark: suma tirajelor cu traverse_tree() vs. parcurgerile care afișează
+ * Utilizare: bench_visitor [n]   (implicit 1000000)
+ *
+ * Afișarea este redirecționată spre /dev/null, deci măsoară doar costul stdio.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+typedef struct {
+    long long total;
+    int limit;                          // Pentru căutarea cu oprire: primul tiraj peste limită
+    BinaryTreeNode * found;
+} SumContext;
+
+static bool sum_quantity(BinaryTreeNode * tree_node, void * context) {
+    ((SumContext *)context)->total += tree_node->book->quantity_sold;
+    return true;
+}
+
+static bool find_above_limit(BinaryTreeNode * tree_node, void * context) {
+    SumContext * sum = (SumContext *)context;
+    if (tree_node->book->quantity_sold <= sum->limit) return true;
+    sum->found = tree_node;
+    return false;  // Oprim parcurgerea
+}
+
+static double time_printer(void (*printer)(BinaryTree *), BinaryTree * tree) {
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+
+    double start = bench_now();
+    printer(tree);
+    fflush(stdout);
+    double elapsed = bench_now() - start;
+
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+    return elapsed;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+
+    int * keys = bench_shuffled_keys(n, 42);
+    BinaryTree * tree = create_tree(TREE_AVL);
+    long long expected = 0;
+    for (size_t i = 0; i < n; i++) {
+        int quantity = keys[i] % 5000;
+        expected += quantity;
+        insert(tree, create_book(tree, keys[i], "", "", 2000, 100, quantity));
+    }
+    free(keys);
+
+    const char * names[] = { "VSD", "SVD", "SDV", "DFS", "BFS" };
+    void (*printers[])(BinaryTree *) = { VSD_trasversal, SVD_trasversal, SDV_trasversal, DFS, BFS };
+
+    printf("n = %zu (AVL)\n", n);
+    for (int order = TRAVERSAL_VSD; order <= TRAVERSAL_BFS; order++) {
+        SumContext sum = { 0, 0, NULL };
+        double start = bench_now();
+        traverse_tree(tree, (TraversalOrder)order, sum_quantity, &sum);
+        double walk = bench_now() - start;
+        double print = time_printer(printers[order], tree);
+
+        printf("  %s: suma %.3f s (%.1f ns/nod, %s)   afisare %.3f s   %.1fx\n",
+               names[order], walk, walk * 1e9 / (double)n, sum.total == expected ? "corecta" : "EROARE",
+               print, print / walk);
+    }
+
+    // Oprirea timpurie: prima carte cu tirajul maxim posibil
+    SumContext search = { 0, 4998, NULL };
+    double start = bench_now();
+    bool completed = traverse_tree(tree, TRAVERSAL_SVD, find_above_limit, &search);
+    printf("  oprire timpurie (SVD, primul tiraj > %d): %.6f s, cheia %d%s\n",
+           search.limit, bench_now() - start, search.found ? search.found->key : -1,
+           completed ? " (parcurgere completa)" : "");
+
+    free_tree(tree);
+    return 0;
+}
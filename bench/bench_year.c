@@ -0,0 +1,94 @@
+/**
+ * Benchmark: cărțile dintr-o fereastră de ani prin indexul după an vs. BFS cu filtrare
+ * Utilizare: bench_year [n]   (implicit 1000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "binary_tree.h"
+#include "bench_common.h"
+
+#define FIRST_YEAR 1800
+#define YEAR_SPAN 225
+#define QUERIES 20
+
+typedef struct YearWindow {
+    int from_year;
+    int to_year;
+    size_t count;
+    long long checksum;
+} YearWindow;
+
+static bool filter_node(BinaryTreeNode * tree_node, void * context) {
+    YearWindow * window = (YearWindow *)context;
+    int year = tree_node->book->pub_year;
+    if (year >= window->from_year && year <= window->to_year) {
+        window->count++;
+        window->checksum += tree_node->key;
+    }
+    return true;
+}
+
+static bool collect_book(Book * book, void * context) {
+    YearWindow * window = (YearWindow *)context;
+    window->count++;
+    window->checksum += book->key;
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    size_t n = bench_arg(argc, argv, 1, 1000000);
+    int * keys = bench_shuffled_keys(n, 42);
+
+    BinaryTree * tree = create_tree(TREE_AVL);
+    uint64_t seed = 9;
+    for (size_t i = 0; i < n; i++) {
+        int year = FIRST_YEAR + (int)(bench_rand(&seed) % YEAR_SPAN);
+        insert(tree, create_book(tree, keys[i], "", "", year, 100, 1000));
+    }
+    free(keys);
+
+    double start = bench_now();
+    enable_year_index(tree);
+    printf("n = %zu, ani %d-%d\n", n, FIRST_YEAR, FIRST_YEAR + YEAR_SPAN - 1);
+    printf("  construire index:     %.3f s\n", bench_now() - start);
+
+    double scan = 0.0, indexed = 0.0, counted = 0.0;
+    size_t total = 0;
+    for (int q = 0; q < QUERIES; q++) {
+        // Ferestre de 21 de ani, ca 1920-1940
+        int from_year = FIRST_YEAR + (int)(bench_rand(&seed) % (YEAR_SPAN - 20));
+        YearWindow slow = { from_year, from_year + 20, 0, 0 };
+        YearWindow fast = { from_year, from_year + 20, 0, 0 };
+
+        start = bench_now();
+        traverse_tree(tree, TRAVERSAL_BFS, filter_node, &slow);
+        scan += bench_now() - start;
+
+        start = bench_now();
+        year_range_query(tree, fast.from_year, fast.to_year, collect_book, &fast);
+        indexed += bench_now() - start;
+
+        start = bench_now();
+        size_t count = year_range_count(tree, fast.from_year, fast.to_year);
+        counted += bench_now() - start;
+
+        if (slow.count != fast.count || slow.checksum != fast.checksum || count != fast.count) {
+            printf("eroare index\n");
+            return 1;
+        }
+        total += count;
+    }
+
+    printf("  BFS + filtrare:       %.2f ms / fereastra (%zu carti in medie)\n", scan / QUERIES * 1e3, total / QUERIES);
+    printf("  year_range_query:     %.2f ms / fereastra (%.1fx mai rapid)\n", indexed / QUERIES * 1e3, scan / indexed);
+    printf("  year_range_count:     %.2f us / fereastra\n", counted / QUERIES * 1e6);
+
+    start = bench_now();
+    for (size_t i = 0; i < n / 10; i++) delete_key(tree, (int)i);
+    printf("  stergere %zu carti:   %.3f s (cu index)\n", n / 10, bench_now() - start);
+
+    free_tree(tree);
+    return 0;
+}
@@ -0,0 +1,1818 @@
+/**
+ * Implementarea unui Arbore Binar de Căutare în C
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <limits.h>
+
+#include "binary_tree.h"
+#include "avl_tree.h"
+#include "rb_tree.h"
+#include "scapegoat_tree.h"
+#include "book_index.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TREE_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define TREE_PREFETCH(address) ((void)0)
+#endif
+
+/**
+ * Creează un nou arbore binar gol
+ * @param mode Politica de balansare folosită de insert()
+ * @return Pointer la noul arbore creat
+ */
+BinaryTree * create_tree(TreeBalanceMode mode) {
+    BinaryTree * tree = (BinaryTree *)malloc(sizeof(BinaryTree));
+    tree->root = NULL;
+    tree->mode = mode;
+    tree->node_count = 0;
+    tree->max_node_count = 0;
+    tree->order_statistics = false;  // Dimensiunile subarborilor se calculează la cerere
+    tree->quantity_aggregates = false;  // La fel și agregatele tirajului
+    tree->queue = NULL;  // Coada se creează la prima parcurgere în lățime
+    tree->stack = NULL;  // Stiva se creează la prima parcurgere în adâncime
+    slab_init(&tree->node_slab, sizeof(BinaryTreeNode));
+    slab_init(&tree->book_slab, sizeof(Book));
+    string_pool_init(&tree->strings);
+    tree->author_books = NULL;  // Indexul după autor crește odată cu numărul de autori
+    tree->author_books_capacity = 0;
+    tree->year_index = NULL;  // Indexurile secundare se construiesc la cerere
+    tree->sales_index = NULL;
+    return tree;
+}
+
+/**
+ * Returnează coada de lucru a arborelui, golită și gata de folosire
+ * Coada este creată o singură dată și refolosită de toate parcurgerile în lățime,
+ * astfel încât tabloul ei intern nu se realocă la fiecare apel.
+ * @param tree Arborele căruia îi aparține coada
+ * @return Coada goală a arborelui
+ */
+static Queue * acquire_tree_queue(BinaryTree * tree) {
+    if (!tree->queue) tree->queue = create_queue();
+    queue_clear(tree->queue);
+    return tree->queue;
+}
+
+/**
+ * Returnează stiva de lucru a arborelui, golită și gata de folosire
+ * La fel ca la coadă, stiva este creată o singură dată și refolosită de
+ * parcurgerile în adâncime, crescând doar până la adâncimea maximă întâlnită.
+ * @param tree Arborele căruia îi aparține stiva
+ * @return Stiva goală a arborelui
+ */
+static Stack * acquire_tree_stack(BinaryTree * tree) {
+    if (!tree->stack) tree->stack = create_stack();
+    stack_clear(tree->stack);
+    return tree->stack;
+}
+
+/**
+ * Returnează agregatele unui nod alocat ca AggregateNode (node->aggregates == 1)
+ */
+static AggregateNode * aggregate_node(BinaryTreeNode * tree_node) {
+    return (AggregateNode *)tree_node;
+}
+
+/**
+ * Creează un nou nod pentru arborele binar
+ * Nodul este alocat din blocurile arborelui, nu cu malloc; cu agregatele pornite
+ * blocurile conțin AggregateNode, altfel doar BinaryTreeNode.
+ * @param tree Arborele căruia îi va aparține nodul
+ * @param book Cartea care va fi stocată în noul nod
+ * @return Pointer la noul nod creat
+ */
+BinaryTreeNode * create_tree_node(BinaryTree * tree, Book * book) {
+    BinaryTreeNode * node = (BinaryTreeNode *)slab_alloc(&tree->node_slab);
+    node->key = book->key;  // Copie a cheii, ca la căutare să nu fie citită și cartea
+    node->book = book;
+    node->left = NULL;
+    node->right = NULL;
+    node->height = 1;  // Un nod nou este o frunză
+    node->size = 1;
+    node->aggregates = tree->quantity_aggregates;
+    if (node->aggregates) {
+        aggregate_node(node)->quantity_sum = book->quantity_sold;
+        aggregate_node(node)->quantity_max = book->quantity_sold;
+    }
+    node->color = NODE_RED;  // În modul roșu-negru un nod nou este roșu
+    return node;
+}
+
+/**
+ * Creează o nouă carte cu valorile specificate
+ * Cartea este alocată din blocurile arborelui și eliberată odată cu acesta
+ * @param tree Arborele în care va fi inserată cartea
+ * @param key Cheia cărții
+ * @param title Titlul cărții
+ * @param author Autorul cărții
+ * @param pub_year Anul publicării
+ * @param page_count Numărul de pagini
+ * @param quantity_sold Tirajul (numărul de exemplare vândute)
+ * @return Pointer la noua carte creată
+ */
+Book * create_book(BinaryTree * tree, int key, char * title, char * author, int pub_year, int page_count, int quantity_sold) {
+    Book * book = (Book *)slab_alloc(&tree->book_slab);
+    book->key = key;
+    book->title = string_pool_store(&tree->strings, title);      // Titlul se copiază o singură dată
+    book->author_id = string_pool_intern(&tree->strings, author); // Autorii care se repetă sunt păstrați o dată
+    book->pub_year = pub_year;
+    book->page_count = page_count;
+    book->quantity_sold = quantity_sold;
+    book->prev_by_author = NULL;  // Cartea intră în indexul după autor abia la inserare
+    book->next_by_author = NULL;
+    return book;
+}
+
+/**
+ * Returnează numele autorului unei cărți
+ * @param tree Arborele căruia îi aparține cartea
+ * @param book Cartea
+ * @return Numele autorului
+ */
+const char * get_book_author(BinaryTree * tree, Book * book) {
+    return string_pool_author(&tree->strings, book->author_id);
+}
+
+/**
+ * Adaugă o carte inserată în lista autorului ei
+ * Tabloul de liste este indexat după author_id (identificatorii sunt 0, 1, 2, ...)
+ * și crește prin dublare, la fel ca tabloul de autori din depozitul de șiruri.
+ * @param tree Arborele
+ * @param book Cartea inserată
+ */
+static void link_author_book(BinaryTree * tree, Book * book) {
+    if (book->author_id >= tree->author_books_capacity) {
+        int capacity = tree->author_books_capacity ? tree->author_books_capacity : AUTHOR_TABLE_INITIAL_CAPACITY;
+        while (capacity <= book->author_id) capacity *= 2;
+        tree->author_books = (Book **)realloc(tree->author_books, capacity * sizeof(Book *));
+        memset(tree->author_books + tree->author_books_capacity, 0,
+               (capacity - tree->author_books_capacity) * sizeof(Book *));
+        tree->author_books_capacity = capacity;
+    }
+
+    Book * head = tree->author_books[book->author_id];
+    book->prev_by_author = NULL;
+    book->next_by_author = head;
+    if (head) head->prev_by_author = book;
+    tree->author_books[book->author_id] = book;
+}
+
+/**
+ * Scoate o carte din lista autorului ei, în O(1)
+ * @param tree Arborele
+ * @param book Cartea care părăsește arborele
+ */
+static void unlink_author_book(BinaryTree * tree, Book * book) {
+    if (book->prev_by_author) {
+        book->prev_by_author->next_by_author = book->next_by_author;
+    } else if (book->author_id < tree->author_books_capacity && tree->author_books[book->author_id] == book) {
+        tree->author_books[book->author_id] = book->next_by_author;
+    }
+    if (book->next_by_author) book->next_by_author->prev_by_author = book->prev_by_author;
+    book->prev_by_author = NULL;
+    book->next_by_author = NULL;
+}
+
+/**
+ * Returnează prima carte din arbore a autorului cu identificatorul dat
+ * Celelalte cărți ale autorului se obțin urmând câmpul next_by_author.
+ * Complexitate: O(1)
+ * @param tree Arborele
+ * @param author_id Identificatorul autorului (book->author_id)
+ * @return Prima carte a autorului sau NULL dacă autorul nu are cărți în arbore
+ */
+Book * get_author_books(BinaryTree * tree, int author_id) {
+    if (author_id < 0 || author_id >= tree->author_books_capacity) return NULL;
+    return tree->author_books[author_id];
+}
+
+/**
+ * Returnează prima carte din arbore a autorului cu numele dat
+ * Numele este căutat în tabela de dispersie a autorilor, fără a parcurge arborele;
+ * toate cărțile autorului se parcurg apoi cu next_by_author.
+ * Complexitate: O(1 + numărul de cărți ale autorului)
+ * @param tree Arborele
+ * @param author Numele autorului
+ * @return Prima carte a autorului sau NULL dacă autorul nu are cărți în arbore
+ */
+Book * find_books_by_author(BinaryTree * tree, const char * author) {
+    return get_author_books(tree, string_pool_find(&tree->strings, author));
+}
+
+/**
+ * Eliberează un nod scos din arbore împreună cu cartea lui
+ * Memoria, inclusiv locul titlului, se întoarce în blocurile arborelui și este refolosită la inserările următoare
+ * @param tree Arborele căruia îi aparține nodul
+ * @param tree_node Nodul eliberat
+ */
+void destroy_tree_node(BinaryTree * tree, BinaryTreeNode * tree_node) {
+    unlink_author_book(tree, tree_node->book);
+    if (tree->year_index) book_index_remove(tree->year_index, tree_node->book);
+    if (tree->sales_index) book_index_remove(tree->sales_index, tree_node->book);
+    string_pool_discard(&tree->strings, tree_node->book->title);
+    slab_free(&tree->book_slab, tree_node->book);
+    slab_free(&tree->node_slab, tree_node);
+}
+
+/**
+ * Actualizează dimensiunile și agregatele nodurilor de pe drumul pe care va fi inserat nodul
+ * Toate modurile coboară la fel, deci drumul este cunoscut dinainte; rotațiile
+ * făcute apoi de politica de balansare recalculează nodurile pe care le mută.
+ * @param tree Arborele
+ * @param new_node Nodul care urmează să fie inserat
+ */
+static void grow_insert_path(BinaryTree * tree, BinaryTreeNode * new_node) {
+    int key = new_node->key;
+    int quantity = new_node->book->quantity_sold;
+
+    for (BinaryTreeNode * current = tree->root; current;
+         current = (current->key > key) ? current->left : current->right) {
+        if (tree->order_statistics) current->size++;
+        if (tree->quantity_aggregates) {
+            AggregateNode * aggregate = aggregate_node(current);
+            aggregate->quantity_sum += quantity;
+            if (quantity > aggregate->quantity_max) aggregate->quantity_max = quantity;
+        }
+    }
+}
+
+/**
+ * Actualizează dimensiunile și agregatele nodurilor de pe drumul spre nodul care va fi eliminat
+ * Toate modurile caută nodul la fel și, pentru un nod cu doi copii, elimină
+ * succesorul (cel mai din stânga nod al subarborelui drept), după ce nodul țintă
+ * îi preia cartea. Valorile finale sunt scrise înainte de eliminare, de jos în sus,
+ * astfel încât rotațiile făcute apoi de politica de balansare să găsească
+ * copiii deja actualizați. Cheia trebuie să existe.
+ * @param tree Arborele
+ * @param key Cheia care urmează să fie ștearsă
+ */
+static void shrink_delete_path(BinaryTree * tree, int key) {
+    Stack * path = acquire_tree_stack(tree);
+
+    BinaryTreeNode * target = tree->root;
+    while (target->key != key) {
+        stack_push(path, target);
+        target = (target->key > key) ? target->left : target->right;
+    }
+    stack_push(path, target);
+
+    BinaryTreeNode * removed = target;
+    if (target->left && target->right) {
+        for (removed = target->right; removed; removed = removed->left) stack_push(path, removed);
+        removed = stack_peek(path);
+    }
+
+    // Nodul eliminat este înlocuit de singurul lui copil
+    stack_pop(path);
+    BinaryTreeNode * replacement = removed->left ? removed->left : removed->right;
+    BinaryTreeNode * below = removed;
+    int below_size = node_size(replacement);
+    long long below_sum = tree->quantity_aggregates ? node_quantity_sum(replacement) : 0;
+    int below_max = tree->quantity_aggregates ? node_quantity_max(replacement) : NOT_FOUND_QUANTITY;
+
+    while (!is_stack_empty(path)) {
+        BinaryTreeNode * current = stack_pop(path);
+        BinaryTreeNode * other = (current->left == below) ? current->right : current->left;
+
+        current->size = 1 + below_size + node_size(other);
+
+        if (tree->quantity_aggregates) {
+            // Nodul țintă rămâne în arbore, dar cu cartea succesorului
+            AggregateNode * aggregate = aggregate_node(current);
+            int own = (current == target) ? removed->book->quantity_sold : current->book->quantity_sold;
+            aggregate->quantity_sum = own + below_sum + node_quantity_sum(other);
+            aggregate->quantity_max = max(own, max(below_max, node_quantity_max(other)));
+            below_sum = aggregate->quantity_sum;
+            below_max = aggregate->quantity_max;
+        }
+
+        below = current;
+        below_size = current->size;
+    }
+}
+
+/**
+ * Inserează o carte în arborele binar de căutare
+ * @param tree Arborele în care se va insera cartea
+ * @param book Cartea care va fi inserată
+ */
+void insert(BinaryTree * tree, Book * book) {
+    BinaryTreeNode * new_node = create_tree_node(tree, book);
+    tree->node_count++;
+    link_author_book(tree, book);
+    if (tree->year_index) book_index_insert(tree->year_index, book);
+    if (tree->sales_index) book_index_insert(tree->sales_index, book);
+
+    // Dimensiunile și agregatele cresc pe drumul de inserare (același în toate modurile)
+    if (tree->order_statistics || tree->quantity_aggregates) grow_insert_path(tree, new_node);
+
+    // În modul AVL inserarea este urmată de rebalansarea drumului
+    if (tree->mode == TREE_AVL) {
+        avl_insert_node(tree, new_node);
+        return;
+    }
+
+    // În modul roșu-negru inserarea este urmată de recolorare și cel mult două rotații
+    if (tree->mode == TREE_RED_BLACK) {
+        rb_insert_node(tree, new_node);
+        return;
+    }
+
+    // În modul scapegoat un drum prea lung declanșează reconstruirea unui subarbore
+    if (tree->mode == TREE_SCAPEGOAT) {
+        scapegoat_insert_node(tree, new_node);
+        return;
+    }
+
+    BinaryTreeNode * root = tree->root;
+
+    // Cazul special: arborele este gol
+    if (!root) {
+        tree->root = new_node;
+        return;
+    }
+
+    // Parcurgem arborele pentru a găsi poziția corectă de inserare
+    while (true) {
+        if (root->key > new_node->key) {
+            // Mergem în stânga dacă cheia este mai mică
+            if (!root->left) {
+                root->left = new_node;
+                return;
+            } else {
+                root = root->left;
+            }
+        } else {
+            // Mergem în dreapta dacă cheia este mai mare sau egală
+            if (!root->right) {
+                root->right = new_node;
+                return;
+            } else {
+                root = root->right;
+            }
+        }
+    }
+}
+
+/**
+ * Returnează înălțimea stocată a unui nod
+ * @param tree_node Nodul (poate fi NULL)
+ * @return Înălțimea nodului sau 0 pentru un subarbore vid
+ */
+int node_height(BinaryTreeNode * tree_node) {
+    return tree_node ? tree_node->height : 0;
+}
+
+/**
+ * Returnează numărul de noduri din subarbore (valid doar cu statistici de ordine)
+ * @param tree_node Nodul (poate fi NULL)
+ * @return Dimensiunea subarborelui sau 0 pentru un subarbore vid
+ */
+int node_size(BinaryTreeNode * tree_node) {
+    return tree_node ? tree_node->size : 0;
+}
+
+/**
+ * Returnează suma tirajelor din subarbore (validă doar cu agregate)
+ * @param tree_node Nodul (poate fi NULL)
+ * @return Suma tirajelor sau 0 pentru un subarbore vid
+ */
+long long node_quantity_sum(BinaryTreeNode * tree_node) {
+    return tree_node ? aggregate_node(tree_node)->quantity_sum : 0;
+}
+
+/**
+ * Returnează cel mai mare tiraj din subarbore (valid doar cu agregate)
+ * @param tree_node Nodul (poate fi NULL)
+ * @return Tirajul maxim sau NOT_FOUND_QUANTITY pentru un subarbore vid
+ */
+int node_quantity_max(BinaryTreeNode * tree_node) {
+    return tree_node ? aggregate_node(tree_node)->quantity_max : NOT_FOUND_QUANTITY;
+}
+
+/**
+ * Recalculează informațiile păstrate în nod pe baza copiilor săi
+ * Se apelează după orice modificare a legăturilor nodului (inserare, rotație, reconstruire)
+ * Cartea nodului este citită doar dacă nodul păstrează agregatele tirajului.
+ * @param tree_node Nodul care trebuie actualizat
+ */
+void update_node(BinaryTreeNode * tree_node) {
+    BinaryTreeNode * left = tree_node->left;
+    BinaryTreeNode * right = tree_node->right;
+
+    tree_node->height = 1 + max(node_height(left), node_height(right));
+    tree_node->size = 1 + node_size(left) + node_size(right);
+
+    if (tree_node->aggregates) {
+        AggregateNode * aggregate = aggregate_node(tree_node);
+        int own = tree_node->book->quantity_sold;
+        aggregate->quantity_sum = own + node_quantity_sum(left) + node_quantity_sum(right);
+        aggregate->quantity_max = max(own, max(node_quantity_max(left), node_quantity_max(right)));
+    }
+}
+
+/**
+ * Rotește subarborele la stânga: copilul drept devine rădăcina subarborelui
+ * Ordinea cheilor (inordinea) se păstrează
+ * @param tree_node Rădăcina subarborelui
+ * @return Noua rădăcină a subarborelui
+ */
+BinaryTreeNode * rotate_left(BinaryTreeNode * tree_node) {
+    BinaryTreeNode * pivot = tree_node->right;
+    tree_node->right = pivot->left;
+    pivot->left = tree_node;
+
+    update_node(tree_node);  // Nodul coborât se actualizează primul
+    update_node(pivot);
+    return pivot;
+}
+
+/**
+ * Rotește subarborele la dreapta: copilul stâng devine rădăcina subarborelui
+ * Ordinea cheilor (inordinea) se păstrează
+ * @param tree_node Rădăcina subarborelui
+ * @return Noua rădăcină a subarborelui
+ */
+BinaryTreeNode * rotate_right(BinaryTreeNode * tree_node) {
+    BinaryTreeNode * pivot = tree_node->left;
+    tree_node->left = pivot->right;
+    pivot->right = tree_node;
+
+    update_node(tree_node);  // Nodul coborât se actualizează primul
+    update_node(pivot);
+    return pivot;
+}
+
+/**
+ * Calculează adâncimea (numărul de nivele) a arborelui
+ * @param tree Arborele pentru care se calculează adâncimea
+ * @return Adâncimea arborelui sau NOT_FOUND_DEPTH dacă arborele este gol
+ */
+int get_tree_depth(BinaryTree * tree) {
+    BinaryTreeNode * root = tree->root;
+
+    if (!root) return 0;  // Arborele este gol
+
+    Queue * queue = acquire_tree_queue(tree);
+    enqueue(queue, root);
+
+    int depth = NOT_FOUND_DEPTH;  // Inițializăm cu -1 pentru a începe de la 0
+
+    // Parcurgem arborele nivel cu nivel
+    while (!is_queue_empty(queue)) {
+        int level_nodes_count = queue->size;
+
+        // Procesăm toate nodurile de la nivelul curent
+        for (int i = 0; i < level_nodes_count; i++) {
+            BinaryTreeNode * current_tree_node = dequeue(queue);
+
+            // Adăugăm copiii nodului curent în coadă pentru următorul nivel
+            if (current_tree_node->left) enqueue(queue, current_tree_node->left);
+            if (current_tree_node->right) enqueue(queue, current_tree_node->right);
+        }
+
+        depth++;  // Incrementăm adâncimea după procesarea fiecărui nivel
+    }
+
+    return depth;
+}
+
+/**
+ * Afișează structura arborelui pe nivele
+ * @param tree Arborele care trebuie afișat
+ */
+void display_tree(BinaryTree * tree) {
+    printf("\n");
+
+    BinaryTreeNode * root = tree->root;
+
+    if (!root) {
+        printf("Arborele este vid.\n");
+        return;
+    }
+
+    Queue * queue = acquire_tree_queue(tree);
+    enqueue(queue, root);
+
+    int depth = 0;
+
+    // Parcurgem arborele nivel cu nivel
+    while (!is_queue_empty(queue)) {
+        int level_nodes_count = queue->size;
+
+        printf("Level %d: ", depth);
+
+        // Procesăm toate nodurile de la nivelul curent
+        for (int i = 0; i < level_nodes_count; i++) {
+            BinaryTreeNode * current_tree_node = dequeue(queue);
+            printf("{%d} ", current_tree_node->key);  // Afișăm cheia nodului
+
+            // Adăugăm copiii nodului curent în coadă pentru următorul nivel
+            if (current_tree_node->left) enqueue(queue, current_tree_node->left);
+            if (current_tree_node->right) enqueue(queue, current_tree_node->right);
+        }
+
+        printf("\n");
+        depth++;  // Trecem la următorul nivel
+    }
+
+    printf("\n");
+}
+
+/**
+ * Caută un nod în arbore după cheia specificată
+ * @param tree Arborele în care se caută
+ * @param key Cheia nodului căutat
+ * @return Pointer la nodul găsit sau NULL dacă nu există
+ */
+BinaryTreeNode * get(BinaryTree * tree, int key) {
+    BinaryTreeNode * root = tree->root;
+
+    if (!root) return NULL;  // Arborele este gol
+
+    // Parcurgem arborele pentru a găsi nodul cu cheia specificată
+    while (true) {
+        if (root->key == key) {
+            return root;  // Am găsit nodul
+        }
+
+        if (root->key > key) {
+            // Mergem în stânga dacă cheia căutată este mai mică
+            if (!root->left) return NULL;  // Nu există nod cu cheia specificată
+            root = root->left;
+        }
+
+        if (root->key < key) {
+            // Mergem în dreapta dacă cheia căutată este mai mare
+            if (!root->right) return NULL;  // Nu există nod cu cheia specificată
+            root = root->right;
+        }
+    }
+}
+
+/**
+ * Șterge nodul cu cheia specificată dintr-un arbore de căutare simplu, fără rebalansare
+ * Un nod cu doi copii preia cartea succesorului (cel mai mic nod din
+ * subarborele drept), iar nodul succesorului este cel eliberat.
+ * @param tree Arborele din care se șterge
+ * @param key Cheia căutată
+ * @return true dacă nodul a fost găsit și șters, false altfel
+ */
+static bool bst_delete(BinaryTree * tree, int key) {
+    // Căutăm legătura spre nodul cu cheia specificată
+    BinaryTreeNode ** link = &tree->root;
+    while (*link && (*link)->key != key) {
+        link = ((*link)->key > key) ? &(*link)->left : &(*link)->right;
+    }
+
+    if (!*link) return false;  // Nu există nod cu cheia specificată
+
+    BinaryTreeNode * target = *link;
+
+    if (target->left && target->right) {
+        // Succesorul este cel mai din stânga nod al subarborelui drept
+        link = &target->right;
+        while ((*link)->left) link = &(*link)->left;
+
+        BinaryTreeNode * successor = *link;
+        Book * temp = target->book;
+        target->book = successor->book;
+        successor->book = temp;
+        target->key = successor->key;
+        target = successor;
+    }
+
+    // Nodul eliminat are cel mult un copil, care îi ia locul
+    *link = target->left ? target->left : target->right;
+    destroy_tree_node(tree, target);
+    return true;
+}
+
+/**
+ * Șterge din arbore nodul cu cheia specificată și eliberează cartea lui
+ * În modurile AVL și roșu-negru arborele este rebalansat pe drumul spre
+ * rădăcină, iar în modul scapegoat este reconstruit când a pierdut prea multe
+ * noduri, așa că înălțimea rămâne O(log n) și după multe ștergeri.
+ * Complexitate: O(h), unde h este înălțimea arborelui (amortizat în modul scapegoat)
+ * @param tree Arborele din care se șterge
+ * @param key Cheia căutată
+ * @return true dacă nodul a fost găsit și șters, false altfel
+ */
+bool delete_key(BinaryTree * tree, int key) {
+    if (tree->order_statistics || tree->quantity_aggregates) {
+        if (!get(tree, key)) return false;  // Nu există nod cu cheia specificată
+        shrink_delete_path(tree, key);
+    }
+
+    bool deleted;
+    if (tree->mode == TREE_AVL) {
+        deleted = avl_delete(tree, key);
+    } else if (tree->mode == TREE_RED_BLACK) {
+        deleted = rb_delete(tree, key);
+    } else {
+        deleted = bst_delete(tree, key);
+    }
+
+    if (!deleted) return false;  // Nu există nod cu cheia specificată
+
+    tree->node_count--;
+    if (tree->mode == TREE_SCAPEGOAT) scapegoat_after_delete(tree);
+    return true;
+}
+
+/**
+ * Caută mai multe chei deodată, intercalând căutările (tehnica AMAC)
+ * Până la GET_BATCH_GROUP căutări sunt în curs simultan: fiecare avansează cu
+ * câte un nivel pe rând, iar nodul următor este preîncărcat, astfel încât
+ * până când căutarea revine la el nodul a ajuns deja în cache. O căutare
+ * terminată își eliberează locul pentru următoarea cheie din lot.
+ * @param tree Arborele în care se caută
+ * @param keys Cheile căutate
+ * @param count Numărul de chei
+ * @param out Pentru fiecare cheie, nodul găsit sau NULL (ca get())
+ */
+void get_batch(BinaryTree * tree, const int * keys, size_t count, BinaryTreeNode ** out) {
+    BinaryTreeNode * current[GET_BATCH_GROUP];  // Nodul curent al fiecărei căutări în curs
+    size_t query[GET_BATCH_GROUP];              // Indicele cheii căutate în fiecare loc
+    size_t next_query = 0;
+    int active = 0;
+
+    // Pornim primele căutări de la rădăcină
+    for (int slot = 0; slot < GET_BATCH_GROUP; slot++) {
+        if (next_query < count) {
+            query[slot] = next_query++;
+            current[slot] = tree->root;
+            active++;
+        } else {
+            query[slot] = count;  // Loc liber
+        }
+    }
+
+    while (active > 0) {
+        for (int slot = 0; slot < GET_BATCH_GROUP; slot++) {
+            if (query[slot] == count) continue;
+
+            BinaryTreeNode * node = current[slot];
+            int key = keys[query[slot]];
+
+            // Căutare în curs: coborâm un nivel și preîncărcăm nodul următor
+            if (node && node->key != key) {
+                node = (node->key > key) ? node->left : node->right;
+                current[slot] = node;
+                TREE_PREFETCH(node);
+                continue;
+            }
+
+            // Căutare terminată: scriem rezultatul și începem următoarea cheie
+            out[query[slot]] = node;
+            if (next_query < count) {
+                query[slot] = next_query++;
+                current[slot] = tree->root;
+            } else {
+                query[slot] = count;
+                active--;
+            }
+        }
+    }
+}
+
+/**
+ * Vizitează nodurile unui subarbore în preordine, folosind o stivă explicită
+ * Funcțiile de parcurgere nu sunt recursive: un arbore degenerat (de exemplu
+ * construit din chei sortate) are adâncimea n și ar depăși stiva C.
+ * Copiii sunt citiți după vizitarea nodului, deci vizitatorul îi poate modifica.
+ * @param stack Stiva de lucru (goală)
+ * @param tree_node Rădăcina subarborelui
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Datele transmise vizitatorului
+ * @return false dacă vizitatorul a oprit parcurgerea, true altfel
+ */
+static bool walk_preorder(Stack * stack, BinaryTreeNode * tree_node, TreeVisitor visitor, void * context) {
+    stack_push(stack, tree_node);
+
+    while (!is_stack_empty(stack)) {
+        BinaryTreeNode * current = stack_pop(stack);
+        if (!visitor(current, context)) return false;  // Procesăm nodul curent
+
+        // Dreapta se adaugă prima, ca subarborele stâng să fie procesat înainte
+        if (current->right) stack_push(stack, current->right);
+        if (current->left) stack_push(stack, current->left);
+    }
+
+    return true;
+}
+
+/**
+ * Vizitează nodurile unui subarbore în inordine, folosind o stivă explicită
+ * @param stack Stiva de lucru (goală)
+ * @param tree_node Rădăcina subarborelui
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Datele transmise vizitatorului
+ * @return false dacă vizitatorul a oprit parcurgerea, true altfel
+ */
+static bool walk_inorder(Stack * stack, BinaryTreeNode * tree_node, TreeVisitor visitor, void * context) {
+    BinaryTreeNode * current = tree_node;
+
+    while (current || !is_stack_empty(stack)) {
+        // Coborâm cât mai la stânga, memorând strămoșii
+        while (current) {
+            stack_push(stack, current);
+            current = current->left;
+        }
+
+        current = stack_pop(stack);
+        if (!visitor(current, context)) return false;  // Procesăm nodul curent
+        current = current->right;  // Continuăm cu subarborele drept
+    }
+
+    return true;
+}
+
+/**
+ * Vizitează nodurile unui subarbore în postordine, folosind o stivă explicită
+ * Un nod este procesat când revenim la el din subarborele drept (sau nu are unul).
+ * @param stack Stiva de lucru (goală)
+ * @param tree_node Rădăcina subarborelui
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Datele transmise vizitatorului
+ * @return false dacă vizitatorul a oprit parcurgerea, true altfel
+ */
+static bool walk_postorder(Stack * stack, BinaryTreeNode * tree_node, TreeVisitor visitor, void * context) {
+    BinaryTreeNode * current = tree_node;
+    BinaryTreeNode * last_visited = NULL;
+
+    while (current || !is_stack_empty(stack)) {
+        while (current) {
+            stack_push(stack, current);
+            current = current->left;
+        }
+
+        BinaryTreeNode * top = stack_peek(stack);
+        if (top->right && top->right != last_visited) {
+            current = top->right;  // Subarborele drept nu a fost încă parcurs
+        } else {
+            if (!visitor(top, context)) return false;  // Procesăm nodul curent
+            last_visited = stack_pop(stack);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Vizitează nodurile unui subarbore nivel cu nivel
+ * @param queue Coada de lucru (goală)
+ * @param tree_node Rădăcina subarborelui
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Datele transmise vizitatorului
+ * @return false dacă vizitatorul a oprit parcurgerea, true altfel
+ */
+static bool walk_level_order(Queue * queue, BinaryTreeNode * tree_node, TreeVisitor visitor, void * context) {
+    enqueue(queue, tree_node);
+
+    // Parcurgem arborele nivel cu nivel
+    while (!is_queue_empty(queue)) {
+        BinaryTreeNode * current_tree_node = dequeue(queue);
+
+        if (!visitor(current_tree_node, context)) return false;  // Procesăm nodul curent
+
+        // Adăugăm copiii nodului curent în coadă
+        if (current_tree_node->left) enqueue(queue, current_tree_node->left);
+        if (current_tree_node->right) enqueue(queue, current_tree_node->right);
+    }
+
+    return true;
+}
+
+/**
+ * Parcurge arborele în ordinea cerută și apelează vizitatorul pentru fiecare nod
+ * Parcurgerea se oprește imediat ce vizitatorul returnează false. Stiva sau
+ * coada de lucru a arborelui sunt refolosite, deci apelul nu face alocări
+ * (după primele parcurgeri). Vizitatorul nu trebuie să insereze sau să șteargă
+ * noduri și nici să pornească o altă parcurgere a aceluiași arbore.
+ * @param tree Arborele care trebuie parcurs
+ * @param order Ordinea parcurgerii
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Datele transmise vizitatorului (de exemplu un acumulator)
+ * @return false dacă vizitatorul a oprit parcurgerea, true dacă au fost vizitate toate nodurile
+ */
+bool traverse_tree(BinaryTree * tree, TraversalOrder order, TreeVisitor visitor, void * context) {
+    if (order == TRAVERSAL_BFS) return traverse_tree_with(tree, order, visitor, context, NULL, acquire_tree_queue(tree));
+    return traverse_tree_with(tree, order, visitor, context, acquire_tree_stack(tree), NULL);
+}
+
+/**
+ * Parcurge arborele ca traverse_tree(), dar cu stiva sau coada primite de la apelant
+ * Arborele nu este modificat deloc, deci mai multe fire pot parcurge simultan
+ * același arbore, fiecare cu stiva sau coada lui (vezi concurrent_tree.h).
+ * @param tree Arborele
+ * @param order Ordinea de parcurgere
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Date transmise vizitatorului
+ * @param stack Stiva goală folosită de parcurgerile în adâncime (poate fi NULL pentru TRAVERSAL_BFS)
+ * @param queue Coada goală folosită de parcurgerea în lățime (poate fi NULL în celelalte ordini)
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool traverse_tree_with(BinaryTree * tree, TraversalOrder order, TreeVisitor visitor, void * context,
+                        Stack * stack, Queue * queue) {
+    if (!tree->root) return true;  // Arborele este gol
+
+    switch (order) {
+        case TRAVERSAL_VSD:
+        case TRAVERSAL_DFS:  // DFS este implementat ca VSD
+            return walk_preorder(stack, tree->root, visitor, context);
+        case TRAVERSAL_SVD:
+            return walk_inorder(stack, tree->root, visitor, context);
+        case TRAVERSAL_SDV:
+            return walk_postorder(stack, tree->root, visitor, context);
+        case TRAVERSAL_BFS:
+            return walk_level_order(queue, tree->root, visitor, context);
+    }
+
+    return true;
+}
+
+/**
+ * Vizitează în ordine crescătoare nodurile cu cheile în intervalul [lo, hi]
+ * Subarborii aflați în întregime în afara intervalului nu sunt parcurși: la
+ * coborâre se sare peste nodurile cu cheia mai mică decât lo (și peste
+ * subarborii lor stângi), iar parcurgerea se oprește la prima cheie mai mare
+ * decât hi. Ca la traverse_tree(), vizitatorul poate opri parcurgerea.
+ * Complexitate: O(h + k), unde k este numărul de noduri din interval
+ * @param tree Arborele
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @param visitor Funcția apelată pentru fiecare nod din interval
+ * @param context Datele transmise vizitatorului
+ * @return false dacă vizitatorul a oprit parcurgerea, true altfel
+ */
+bool range_query(BinaryTree * tree, int lo, int hi, TreeVisitor visitor, void * context) {
+    return range_query_with(tree, lo, hi, visitor, context, acquire_tree_stack(tree));
+}
+
+/**
+ * Vizitează nodurile din intervalul [lo, hi] ca range_query(), dar cu stiva primită de la apelant
+ * Arborele nu este modificat, deci interogarea poate rula simultan cu alte citiri.
+ * @param tree Arborele
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @param visitor Funcția apelată pentru fiecare nod
+ * @param context Date transmise vizitatorului
+ * @param stack Stiva goală folosită pentru drum
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool range_query_with(BinaryTree * tree, int lo, int hi, TreeVisitor visitor, void * context, Stack * stack) {
+    BinaryTreeNode * current = tree->root;
+
+    while (current || !is_stack_empty(stack)) {
+        // Coborâm spre stânga doar prin nodurile care pot fi în interval
+        while (current) {
+            if (current->key < lo) {
+                current = current->right;  // Nodul și subarborele stâng sunt înainte de interval
+            } else {
+                stack_push(stack, current);
+                current = current->left;
+            }
+        }
+
+        current = stack_pop(stack);
+        if (!current) break;  // Nicio cheie rămasă nu este >= lo (stiva goală)
+        if (current->key > hi) return true;  // Toate cheile rămase sunt după interval
+        if (!visitor(current, context)) return false;
+        current = current->right;
+    }
+
+    return true;
+}
+
+/**
+ * Vizitator care numără nodurile
+ * @param tree_node Nodul vizitat
+ * @param context Contorul (size_t *)
+ * @return true (parcurgerea continuă)
+ */
+static bool count_node(BinaryTreeNode * tree_node, void * context) {
+    (void)tree_node;
+    (*(size_t *)context)++;
+    return true;
+}
+
+/**
+ * Numără cheile mai mici (sau, cu inclusive, mai mici sau egale) decât key
+ * Folosește dimensiunile subarborilor, deci cere statistici de ordine.
+ * @param tree Arborele
+ * @param key Cheia de comparat
+ * @param inclusive Dacă se numără și cheile egale
+ * @return Numărul de chei
+ */
+static size_t count_keys_below(BinaryTree * tree, int key, bool inclusive) {
+    size_t count = 0;
+    BinaryTreeNode * current = tree->root;
+
+    while (current) {
+        if (current->key < key || (inclusive && current->key == key)) {
+            count += (size_t)node_size(current->left) + 1;  // Nodul și subarborele stâng sunt înainte
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Numără nodurile cu cheile în intervalul [lo, hi]
+ * Cu statistici de ordine răspunsul se obține din două coborâri, în O(h);
+ * altfel intervalul este parcurs cu range_query(), în O(h + k).
+ * @param tree Arborele
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @return Numărul de noduri din interval
+ */
+size_t range_count(BinaryTree * tree, int lo, int hi) {
+    if (lo > hi) return 0;
+
+    if (tree->order_statistics) {
+        return count_keys_below(tree, hi, true) - count_keys_below(tree, lo, false);
+    }
+
+    size_t count = 0;
+    range_query(tree, lo, hi, count_node, &count);
+    return count;
+}
+
+/**
+ * Vizitator care recalculează dimensiunea (și înălțimea) nodului din copiii săi
+ * Folosit în postordine, deci copiii sunt deja actualizați.
+ * @param tree_node Nodul vizitat
+ * @param context Nefolosit
+ * @return true (parcurgerea continuă)
+ */
+static bool refresh_node(BinaryTreeNode * tree_node, void * context) {
+    (void)context;
+    update_node(tree_node);
+    return true;
+}
+
+/**
+ * Pornește păstrarea dimensiunii subarborilor în noduri
+ * Dimensiunile se calculează o dată pentru tot arborele, apoi sunt actualizate de
+ * inserări, ștergeri, rotații și balance_tree(). Câmpul size încape în padding-ul
+ * nodului, deci costul este doar actualizarea drumului la fiecare modificare.
+ * Complexitate: O(n) la activare
+ * @param tree Arborele
+ */
+void enable_order_statistics(BinaryTree * tree) {
+    if (tree->order_statistics) return;
+    traverse_tree(tree, TRAVERSAL_SDV, refresh_node, NULL);
+    tree->order_statistics = true;
+}
+
+/**
+ * Returnează nodul cu a k-a cea mai mică cheie (k numărat de la 0)
+ * Dacă arborele nu păstrează încă dimensiunile, acestea sunt calculate acum.
+ * Complexitate: O(h)
+ * @param tree Arborele
+ * @param k Poziția în ordinea crescătoare a cheilor
+ * @return Nodul de pe poziția k sau NULL dacă k >= numărul de noduri
+ */
+BinaryTreeNode * tree_select(BinaryTree * tree, size_t k) {
+    enable_order_statistics(tree);
+
+    BinaryTreeNode * current = tree->root;
+    while (current) {
+        size_t left_size = (size_t)node_size(current->left);
+        if (k < left_size) {
+            current = current->left;
+        } else if (k == left_size) {
+            return current;
+        } else {
+            k -= left_size + 1;  // Sărim peste subarborele stâng și nodul curent
+            current = current->right;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Returnează numărul de chei strict mai mici decât key
+ * Este și poziția pe care tree_select() găsește prima cheie mai mare sau egală cu key.
+ * Dacă arborele nu păstrează încă dimensiunile, acestea sunt calculate acum.
+ * Complexitate: O(h)
+ * @param tree Arborele
+ * @param key Cheia
+ * @return Numărul de chei mai mici decât key
+ */
+size_t tree_rank(BinaryTree * tree, int key) {
+    enable_order_statistics(tree);
+    return count_keys_below(tree, key, false);
+}
+
+/**
+ * Pornește păstrarea sumei și a maximului tirajelor din fiecare subarbore
+ * Nodurile obișnuite nu au loc pentru agregate, așa că arborele trebuie să fie gol:
+ * de acum nodurile se alocă din blocuri de AggregateNode. Un arbore cu noduri ar
+ * trebui copiat în noduri noi, iar pointerii obținuți înainte (de exemplu de la get())
+ * ar deveni invalizi, deci în acest caz funcția nu face nimic și returnează false.
+ * Agregatele sunt apoi actualizate de inserări, ștergeri, update_quantity(),
+ * rotații și balance_tree().
+ * Tirajul unei cărți din arbore trebuie modificat doar prin update_quantity().
+ * Complexitate: O(1)
+ * @param tree Arborele (gol)
+ * @return true dacă agregatele sunt pornite, false dacă arborele are deja noduri
+ */
+bool enable_quantity_aggregates(BinaryTree * tree) {
+    if (tree->quantity_aggregates) return true;
+    if (tree->root) return false;
+
+    // Blocurile rămase de la nodurile șterse au dimensiunea veche
+    slab_release(&tree->node_slab);
+    slab_init(&tree->node_slab, sizeof(AggregateNode));
+    tree->quantity_aggregates = true;
+    return true;
+}
+
+/**
+ * Schimbă tirajul unei cărți din arbore, mutând-o și în indexul după tiraj
+ * Cartea este scoasă din index cu valoarea veche și reinserată cu cea nouă.
+ * @param tree Arborele
+ * @param book Cartea
+ * @param quantity_sold Noul tiraj
+ */
+static void set_book_quantity(BinaryTree * tree, Book * book, int quantity_sold) {
+    if (tree->sales_index) book_index_remove(tree->sales_index, book);
+    book->quantity_sold = quantity_sold;
+    if (tree->sales_index) book_index_insert(tree->sales_index, book);
+}
+
+/**
+ * Modifică tirajul cărții cu cheia dată și actualizează agregatele pe drumul spre rădăcină
+ * Dacă indexul după tiraj este pornit, cartea își schimbă și locul în index.
+ * Complexitate: O(h + log n)
+ * @param tree Arborele
+ * @param key Cheia cărții
+ * @param quantity_sold Noul tiraj
+ * @return true dacă cartea a fost găsită, false altfel
+ */
+bool update_quantity(BinaryTree * tree, int key, int quantity_sold) {
+    if (!tree->quantity_aggregates) {
+        BinaryTreeNode * tree_node = get(tree, key);
+        if (!tree_node) return false;
+        set_book_quantity(tree, tree_node->book, quantity_sold);
+        return true;
+    }
+
+    // Memorăm drumul, apoi recalculăm nodurile de jos în sus
+    Stack * path = acquire_tree_stack(tree);
+    BinaryTreeNode * current = tree->root;
+    while (current && current->key != key) {
+        stack_push(path, current);
+        current = (current->key > key) ? current->left : current->right;
+    }
+
+    if (!current) return false;  // Nu există nod cu cheia specificată
+
+    set_book_quantity(tree, current->book, quantity_sold);
+    update_node(current);
+    while (!is_stack_empty(path)) update_node(stack_pop(path));
+    return true;
+}
+
+/**
+ * Adună tirajele cheilor mai mici (sau, cu inclusive, mai mici sau egale) decât key
+ * @param tree Arborele (cu agregate)
+ * @param key Cheia de comparat
+ * @param inclusive Dacă se adună și cheile egale
+ * @return Suma tirajelor
+ */
+static long long sum_keys_below(BinaryTree * tree, int key, bool inclusive) {
+    long long sum = 0;
+    BinaryTreeNode * current = tree->root;
+
+    while (current) {
+        if (current->key < key || (inclusive && current->key == key)) {
+            // Nodul și subarborele stâng sunt înainte
+            sum += current->book->quantity_sold + node_quantity_sum(current->left);
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+
+    return sum;
+}
+
+/**
+ * Suma și maximul tirajelor adunate de accumulate_quantity()
+ */
+typedef struct QuantityTotals {
+    long long sum;
+    int max;
+} QuantityTotals;
+
+/**
+ * Vizitator care adună tirajul nodului la suma și maximul din context
+ * Folosit de range_sum()/range_max() pe arborii fără agregate.
+ * @param tree_node Nodul vizitat
+ * @param context Totalurile (QuantityTotals *)
+ * @return true (parcurgerea continuă)
+ */
+static bool accumulate_quantity(BinaryTreeNode * tree_node, void * context) {
+    QuantityTotals * totals = (QuantityTotals *)context;
+    totals->sum += tree_node->book->quantity_sold;
+    totals->max = max(totals->max, tree_node->book->quantity_sold);
+    return true;
+}
+
+/**
+ * Calculează suma tirajelor cărților cu cheile în intervalul [lo, hi]
+ * Fără enable_quantity_aggregates() cărțile din interval sunt parcurse una câte una.
+ * Complexitate: O(h) cu agregate, indiferent de lățimea intervalului; altfel O(h + k)
+ * @param tree Arborele
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @return Suma tirajelor
+ */
+long long range_sum(BinaryTree * tree, int lo, int hi) {
+    if (lo > hi) return 0;
+
+    if (!tree->quantity_aggregates) {
+        QuantityTotals totals = { 0, NOT_FOUND_QUANTITY };
+        range_query(tree, lo, hi, accumulate_quantity, &totals);
+        return totals.sum;
+    }
+
+    return sum_keys_below(tree, hi, true) - sum_keys_below(tree, lo, false);
+}
+
+/**
+ * Calculează cel mai mare tiraj al cărților cu cheile în intervalul [lo, hi]
+ * Coborâm până la primul nod din interval (nodul de separare), apoi pe cele
+ * două drumuri spre lo și hi: fiecare nod din interval contribuie cu propriul
+ * tiraj și cu maximul subarborelui aflat spre interior, care este în întregime
+ * în interval. Fără enable_quantity_aggregates() cărțile din interval sunt parcurse una câte una.
+ * Complexitate: O(h) cu agregate, indiferent de lățimea intervalului; altfel O(h + k)
+ * @param tree Arborele
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @return Tirajul maxim sau NOT_FOUND_QUANTITY dacă intervalul nu conține cărți
+ */
+int range_max(BinaryTree * tree, int lo, int hi) {
+    if (lo > hi) return NOT_FOUND_QUANTITY;
+
+    if (!tree->quantity_aggregates) {
+        QuantityTotals totals = { 0, NOT_FOUND_QUANTITY };
+        range_query(tree, lo, hi, accumulate_quantity, &totals);
+        return totals.max;
+    }
+
+    // Nodul de separare: primul nod de pe drum cu cheia în interval
+    BinaryTreeNode * split = tree->root;
+    while (split && (split->key < lo || split->key > hi)) {
+        split = (split->key < lo) ? split->right : split->left;
+    }
+
+    if (!split) return NOT_FOUND_QUANTITY;  // Nicio cheie în interval
+
+    int result = split->book->quantity_sold;
+
+    // Drumul spre lo: subarborii drepți ai nodurilor din interval sunt în interval
+    for (BinaryTreeNode * current = split->left; current;) {
+        if (current->key >= lo) {
+            result = max(result, max(current->book->quantity_sold, node_quantity_max(current->right)));
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+
+    // Drumul spre hi: subarborii stângi ai nodurilor din interval sunt în interval
+    for (BinaryTreeNode * current = split->right; current;) {
+        if (current->key <= hi) {
+            result = max(result, max(current->book->quantity_sold, node_quantity_max(current->left)));
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Extrage anul publicării, valoarea după care este ordonat indexul după an
+ */
+static int book_pub_year(const Book * book) {
+    return book->pub_year;
+}
+
+/**
+ * Vizitator care adaugă cartea nodului în indexul primit ca context
+ */
+static bool index_node_book(BinaryTreeNode * tree_node, void * context) {
+    book_index_insert((BookIndex *)context, tree_node->book);
+    return true;
+}
+
+/**
+ * Pornește indexul secundar după anul publicării
+ * Indexul este ordonat după (an, cheie), împarte cărțile cu arborele și este
+ * actualizat apoi de insert(), delete_key() și clear_tree().
+ * Complexitate: O(n log n) la activare
+ * @param tree Arborele
+ */
+void enable_year_index(BinaryTree * tree) {
+    if (tree->year_index) return;
+    tree->year_index = create_book_index(book_pub_year);
+    traverse_tree(tree, TRAVERSAL_SVD, index_node_book, tree->year_index);
+}
+
+/**
+ * Vizitează cărțile publicate între from_year și to_year, în ordinea (an, cheie)
+ * Dacă indexul după an nu este pornit, este construit acum.
+ * Complexitate: O(log n + k), unde k este numărul de cărți vizitate
+ * @param tree Arborele
+ * @param from_year Primul an (inclus)
+ * @param to_year Ultimul an (inclus)
+ * @param visitor Funcția apelată pentru fiecare carte
+ * @param context Date transmise vizitatorului
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool year_range_query(BinaryTree * tree, int from_year, int to_year, BookVisitor visitor, void * context) {
+    enable_year_index(tree);
+    return book_index_scan(tree->year_index, from_year, to_year, visitor, context);
+}
+
+/**
+ * Numără cărțile publicate între from_year și to_year, fără a le parcurge
+ * Complexitate: O(log n)
+ * @param tree Arborele
+ * @param from_year Primul an (inclus)
+ * @param to_year Ultimul an (inclus)
+ * @return Numărul de cărți
+ */
+size_t year_range_count(BinaryTree * tree, int from_year, int to_year) {
+    enable_year_index(tree);
+    return book_index_count(tree->year_index, from_year, to_year);
+}
+
+/**
+ * Extrage tirajul, valoarea după care este ordonat indexul după tiraj
+ */
+static int book_quantity_sold(const Book * book) {
+    return book->quantity_sold;
+}
+
+/**
+ * Pornește indexul secundar după tiraj
+ * Indexul este ordonat după (tiraj, cheie) și este actualizat apoi de insert(),
+ * delete_key(), update_quantity() și clear_tree(). Tirajul unei cărți din arbore
+ * trebuie modificat doar prin update_quantity().
+ * Complexitate: O(n log n) la activare
+ * @param tree Arborele
+ */
+void enable_sales_index(BinaryTree * tree) {
+    if (tree->sales_index) return;
+    tree->sales_index = create_book_index(book_quantity_sold);
+    traverse_tree(tree, TRAVERSAL_SVD, index_node_book, tree->sales_index);
+}
+
+/**
+ * Context pentru colectarea primelor cărți dintr-o parcurgere a indexului
+ */
+typedef struct TopBooks {
+    Book ** out;                       // Tabloul în care se scriu cărțile
+    size_t limit;                      // Numărul maxim de cărți
+    size_t count;                      // Numărul de cărți scrise
+} TopBooks;
+
+/**
+ * Vizitator care adaugă cartea în tablou și oprește parcurgerea când tabloul este plin
+ */
+static bool collect_top_book(Book * book, void * context) {
+    TopBooks * top = (TopBooks *)context;
+    top->out[top->count++] = book;
+    return top->count < top->limit;
+}
+
+/**
+ * Găsește cele mai vândute k cărți
+ * Indexul după tiraj este parcurs descrescător de la capătul drept, deci sunt
+ * vizitate doar cărțile returnate. Dacă indexul nu este pornit, este construit acum.
+ * La tiraje egale, cartea cu cheia mai mare este prima.
+ * Complexitate: O(log n + k)
+ * @param tree Arborele
+ * @param k Numărul de cărți cerute
+ * @param out Tablou de cel puțin k elemente, primește cărțile în ordinea descrescătoare a tirajului
+ * @return Numărul de cărți scrise în out (mai mic decât k dacă arborele are mai puține cărți)
+ */
+size_t top_k(BinaryTree * tree, size_t k, Book ** out) {
+    if (k == 0) return 0;
+    enable_sales_index(tree);
+
+    TopBooks top = { out, k, 0 };
+    book_index_scan_reverse(tree->sales_index, INT_MIN, INT_MAX, collect_top_book, &top);
+    return top.count;
+}
+
+/**
+ * Vizitator care afișează cheia nodului
+ * @param tree_node Nodul vizitat
+ * @param context Nefolosit
+ * @return true (parcurgerea continuă)
+ */
+static bool print_node_key(BinaryTreeNode * tree_node, void * context) {
+    (void)context;
+    printf("%d ", tree_node->key);
+    return true;
+}
+
+/**
+ * Parcurge arborele în preordine (Vârf-Stânga-Dreapta)
+ * @param tree_node Nodul curent (începând cu rădăcina)
+ */
+void VSD(BinaryTreeNode * tree_node) {
+    Stack * stack = create_stack();
+    walk_preorder(stack, tree_node, print_node_key, NULL);
+    free_stack(stack);
+}
+
+/**
+ * Inițiază parcurgerea arborelui în preordine
+ * @param tree Arborele care trebuie parcurs
+ */
+void VSD_trasversal(BinaryTree * tree) {
+    if (tree->root) {
+        printf("VSD: ");
+        traverse_tree(tree, TRAVERSAL_VSD, print_node_key, NULL);
+    }
+}
+
+/**
+ * Parcurge arborele în inordine (Stânga-Vârf-Dreapta)
+ * @param tree_node Nodul curent (începând cu rădăcina)
+ */
+void SVD(BinaryTreeNode * tree_node) {
+    Stack * stack = create_stack();
+    walk_inorder(stack, tree_node, print_node_key, NULL);
+    free_stack(stack);
+}
+
+/**
+ * Inițiază parcurgerea arborelui în inordine
+ * @param tree Arborele care trebuie parcurs
+ */
+void SVD_trasversal(BinaryTree * tree) {
+    if (tree->root) {
+        printf("SVD: ");
+        traverse_tree(tree, TRAVERSAL_SVD, print_node_key, NULL);
+    }
+}
+
+/**
+ * Parcurge arborele în postordine (Stânga-Dreapta-Vârf)
+ * @param tree_node Nodul curent (începând cu rădăcina)
+ */
+void SDV(BinaryTreeNode * tree_node) {
+    Stack * stack = create_stack();
+    walk_postorder(stack, tree_node, print_node_key, NULL);
+    free_stack(stack);
+}
+
+/**
+ * Inițiază parcurgerea arborelui în postordine
+ * @param tree Arborele care trebuie parcurs
+ */
+void SDV_trasversal(BinaryTree * tree) {
+    if (tree->root) {
+        printf("SDV: ");
+        traverse_tree(tree, TRAVERSAL_SDV, print_node_key, NULL);
+    }
+}
+
+/**
+ * Parcurge arborele în adâncime (DFS)
+ * Notă: În acest cod, DFS este implementat ca parcurgere în preordine (VSD)
+ * @param tree Arborele care trebuie parcurs
+ */
+void DFS(BinaryTree * tree) {
+    if (tree->root) {
+        printf("DFS: ");
+        traverse_tree(tree, TRAVERSAL_DFS, print_node_key, NULL);
+    }
+}
+
+/**
+ * Parcurge arborele în lățime (BFS)
+ * @param tree Arborele care trebuie parcurs
+ */
+void BFS(BinaryTree * tree) {
+    if (tree->root) {
+        printf("BFS: ");
+        traverse_tree(tree, TRAVERSAL_BFS, print_node_key, NULL);
+    }
+}
+
+/**
+ * Returnează maximul dintre două numere
+ * @param a Primul număr
+ * @param b Al doilea număr
+ * @return Maximul dintre a și b
+ */
+int max(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+/**
+ * Verifică dacă un nod și subarborii săi sunt balansați, coborând cel mult depth_budget nivele
+ * Un arbore balansat are cel mult ~1.44 * log2(n) nivele, deci un drum mai lung
+ * decât AVL_MAX_HEIGHT îl declară direct nebalansat. Astfel recursivitatea
+ * rămâne scurtă chiar și pentru un arbore degenerat în listă.
+ * @param tree_node Nodul curent
+ * @param depth_budget Numărul de nivele pe care mai avem voie să coborâm
+ * @return Înălțimea nodului sau -1 dacă nodul sau subarborii săi nu sunt balansați
+ */
+static int get_node_balance_bounded(BinaryTreeNode * tree_node, int depth_budget) {
+    if (!tree_node) return 0;  // Nodul este NULL (frunză virtuală)
+    if (depth_budget == 0) return -1;  // Prea adânc pentru a fi balansat
+
+    // Verificăm dacă subarborele stâng este balansat
+    int left_balance = get_node_balance_bounded(tree_node->left, depth_budget - 1);
+    if (left_balance == -1) return -1;  // Subarborele stâng nu este balansat
+
+    // Verificăm dacă subarborele drept este balansat
+    int right_balance = get_node_balance_bounded(tree_node->right, depth_budget - 1);
+    if (right_balance == -1) return -1;  // Subarborele drept nu este balansat
+
+    // Verificăm dacă nodul curent este balansat
+    int diff = abs(left_balance - right_balance);
+    if (diff > 1) {
+        return -1;  // Nodul curent nu este balansat
+    }
+
+    // Nodul și subarborii săi sunt balansați, returnăm înălțimea nodului
+    return 1 + max(left_balance, right_balance);
+}
+
+/**
+ * Verifică dacă un nod și subarborii săi sunt balansați și returnează înălțimea nodului
+ * Un arbore este balansat dacă diferența de înălțime între subarborii stâng și drept
+ * ai fiecărui nod este cel mult 1.
+ *
+ * Funcția returnează înălțimea nodului dacă nodul și subarborii săi sunt balansați,
+ * sau -1 dacă nodul sau oricare dintre subarborii săi nu este balansat.
+ *
+ * @param tree_node Nodul curent
+ * @return Înălțimea nodului sau -1 dacă nodul sau subarborii săi nu sunt balansați
+ */
+int get_node_balance(BinaryTreeNode * tree_node) {
+    return get_node_balance_bounded(tree_node, AVL_MAX_HEIGHT);
+}
+
+/**
+ * Verifică dacă arborele este balansat
+ * @param tree Arborele care trebuie verificat
+ * @return true dacă arborele este balansat, false în caz contrar
+ */
+bool is_tree_balanced(BinaryTree * tree) {
+    BinaryTreeNode * root = tree->root;
+
+    if (!tree->root) return true;  // Un arbore gol este considerat balansat
+
+    return get_node_balance(root) != -1;
+}
+
+/**
+ * Creează un nou nod pentru lista dublu înlănțuită
+ * @param tree_node Nodul din arbore care va fi stocat în noul nod de listă
+ * @return Pointer la noul nod de listă creat
+ */
+ListNode * create_list_node(BinaryTreeNode * tree_node) {
+    ListNode * list_node = (ListNode *)malloc(sizeof(ListNode));
+    list_node->tree_node = tree_node;
+    list_node->next = NULL;
+    list_node->prev = NULL;
+    return list_node;
+}
+
+/**
+ * Creează o nouă listă dublu înlănțuită goală
+ * @return Pointer la noua listă creată
+ */
+List * create_list(void) {
+    List * list = (List *)malloc(sizeof(List));
+    list->head = NULL;
+    list->tail = NULL;
+    return list;
+}
+
+/**
+ * Verifică dacă lista este goală
+ * @param list Lista care trebuie verificată
+ * @return true dacă lista este goală, false în caz contrar
+ */
+bool is_list_empty(List * list) {
+    return !list->head && !list->tail;
+}
+
+/**
+ * Adaugă un nod din arbore la sfârșitul listei
+ * @param list Lista în care se va adăuga nodul
+ * @param tree_node Nodul din arbore care va fi adăugat în listă
+ */
+void list_push_back(List * list, BinaryTreeNode * tree_node) {
+    ListNode * new_node = create_list_node(tree_node);
+
+    // Cazul special: lista este goală
+    if (is_list_empty(list)) {
+        list->head = new_node;
+        list->tail = new_node;
+        return;
+    }
+
+    // Adăugăm noul nod la sfârșitul listei
+    new_node->prev = list->tail;
+    list->tail->next = new_node;
+    list->tail = new_node;
+}
+
+/**
+ * Afișează cheile nodurilor din listă
+ * @param list Lista care trebuie afișată
+ */
+void print_list(List * list) {
+    ListNode * head = list->head;
+
+    while (head) {
+        printf("(%d) ", head->tree_node->key);
+        head = head->next;
+    }
+}
+
+/**
+ * Vizitator care adaugă nodul la sfârșitul listei
+ * @param tree_node Nodul vizitat
+ * @param context Lista (List *)
+ * @return true (parcurgerea continuă)
+ */
+static bool append_to_list(BinaryTreeNode * tree_node, void * context) {
+    list_push_back((List *)context, tree_node);
+    return true;
+}
+
+/**
+ * Populează lista în inordine cu nodurile din arbore
+ * Parcurgerea în inordine asigură că nodurile sunt adăugate în listă în ordine crescătoare a cheilor
+ * @param list Lista care trebuie populată
+ * @param tree_node Nodul curent din arbore (începând cu rădăcina)
+ */
+void populate_list(List * list, BinaryTreeNode * tree_node) {
+    if (!tree_node) return;
+    Stack * stack = create_stack();
+    walk_inorder(stack, tree_node, append_to_list, list);
+    free_stack(stack);
+}
+
+/**
+ * Creează o listă cu toate nodurile din arbore, ordonate după cheie
+ * @param tree Arborele ale cărui noduri trebuie adăugate în listă
+ * @return Lista populată cu nodurile din arbore
+ */
+List * get_tree_nodes_list(BinaryTree * tree) {
+    BinaryTreeNode * root = tree->root;
+    List * list = create_list();
+
+    if (!root) return list;  // Arborele este gol
+
+    traverse_tree(tree, TRAVERSAL_SVD, append_to_list, list);  // Populăm lista cu nodurile din arbore
+
+    return list;
+}
+
+/**
+ * Eliberează nodurile listei și structura listei (nodurile din arbore nu sunt afectate)
+ * @param list Lista care trebuie eliberată
+ */
+void free_list(List * list) {
+    ListNode * head = list->head;
+
+    while (head) {
+        ListNode * next = head->next;
+        free(head);
+        head = next;
+    }
+
+    free(list);
+}
+
+/**
+ * Transformă arborele într-o "liană": o listă ordonată legată prin pointerii right
+ * Fiecare nod cu copil stâng este rotit la dreapta până când nu mai are copil
+ * stâng (prima etapă din algoritmul Day-Stout-Warren). Nu se alocă memorie.
+ * Complexitate: O(n)
+ * @param root Rădăcina arborelui
+ * @param count Primește numărul de noduri
+ * @return Primul nod al lianei (cel cu cea mai mică cheie)
+ */
+static BinaryTreeNode * tree_to_vine(BinaryTreeNode * root, size_t * count) {
+    BinaryTreeNode head = { 0 };  // Pseudo-rădăcină: head.right este începutul lianei
+    head.right = root;
+    BinaryTreeNode * tail = &head;
+    BinaryTreeNode * rest = root;
+    *count = 0;
+
+    while (rest) {
+        if (!rest->left) {
+            // Nodul nu mai are copil stâng: îl lăsăm în liană și mergem mai departe
+            tail = rest;
+            rest = rest->right;
+            (*count)++;
+        } else {
+            // Rotație la dreapta: copilul stâng urcă în locul nodului
+            BinaryTreeNode * left = rest->left;
+            rest->left = left->right;
+            left->right = rest;
+            rest = left;
+            tail->right = left;
+        }
+    }
+
+    return head.right;
+}
+
+/**
+ * O trecere de compresie din algoritmul Day-Stout-Warren
+ * Primele count noduri pare ale lianei devin copiii stângi ai nodurilor care le
+ * urmează, printr-o rotație la stânga fiecare. Un nod coborât astfel nu mai este
+ * atins de trecerile următoare și subarborii lui sunt deja finali, deci este recalculat acum.
+ * @param head Pseudo-rădăcina: head->right este începutul lianei
+ * @param count Numărul de rotații
+ */
+static void compress_vine(BinaryTreeNode * head, size_t count) {
+    BinaryTreeNode * scanner = head;
+    for (size_t i = 0; i < count; i++) {
+        BinaryTreeNode * child = scanner->right;
+        scanner->right = child->right;
+        scanner = scanner->right;
+        child->right = scanner->left;
+        scanner->left = child;
+        update_node(child);
+    }
+}
+
+/**
+ * Construiește un arbore balansat din liană prin treceri de compresie (Day-Stout-Warren)
+ * Prima trecere coboară nodurile care nu încap într-un arbore complet, apoi fiecare
+ * trecere înjumătățește liana. Nodurile rămase pe liană formează marginea dreaptă a
+ * arborelui și sunt recalculate la final, de jos în sus.
+ * Memorie suplimentară: O(1), fără recursivitate și fără stivă.
+ * @param vine Începutul lianei
+ * @param count Numărul de noduri din liană
+ * @return Rădăcina arborelui construit
+ */
+static BinaryTreeNode * vine_to_tree(BinaryTreeNode * vine, size_t count) {
+    BinaryTreeNode head = { 0 };  // Pseudo-rădăcină, ca la tree_to_vine()
+    head.right = vine;
+
+    // Cel mai mare arbore perfect (2^k - 1 noduri) care încape în count
+    size_t perfect = 1;
+    while (perfect * 2 + 1 <= count) perfect = perfect * 2 + 1;
+
+    if (count > 0) compress_vine(&head, count - perfect);
+    for (size_t size = perfect; size > 1; size /= 2) compress_vine(&head, size / 2);
+
+    // Marginea dreaptă are O(log n) noduri: o recalculăm de la ultimul spre rădăcină
+    BinaryTreeNode * root = head.right;
+    for (BinaryTreeNode * done = NULL; done != root;) {
+        BinaryTreeNode * current = root;
+        while (current->right != done) current = current->right;
+        update_node(current);
+        done = current;
+    }
+    return root;
+}
+
+/**
+ * Reconstruiește pe loc un subarbore într-o formă perfect balansată
+ * Folosită de balance_tree() pentru tot arborele și de modul scapegoat pentru
+ * subarborele prea adânc. Înălțimile nodurilor sunt recalculate, culorile nu.
+ * Complexitate: O(n) timp, fără alocări, unde n este numărul de noduri din subarbore
+ * @param subtree_root Rădăcina subarborelui
+ * @return Noua rădăcină a subarborelui
+ */
+BinaryTreeNode * rebuild_subtree(BinaryTreeNode * subtree_root) {
+    size_t count;
+    BinaryTreeNode * vine = tree_to_vine(subtree_root, &count);
+    return vine_to_tree(vine, count);
+}
+
+/*
+ * Funcția de balansare a arborelui
+ * Realizează balansarea unui arbore binar de căutare pentru a optimiza operațiile de căutare
+ * Arborele este întâi aplatizat în liană, apoi reconstruit pe loc, refolosind
+ * nodurile existente: nu se alocă memorie, iar înălțimile sunt recalculate.
+ * Complexitate: O(n) unde n este numărul de noduri
+ */
+void balance_tree(BinaryTree * tree) {
+    // Verificăm dacă arborele este deja balansat
+    if (is_tree_balanced(tree)) {
+        printf("Arborele deja este balansat.");
+        return;
+    }
+
+    // Reconstruiește arborele într-o formă balansată
+    tree->root = rebuild_subtree(tree->root);
+    tree->max_node_count = tree->node_count;
+
+    // Culorile vechi nu mai corespund formei noi a arborelui
+    if (tree->mode == TREE_RED_BLACK) rb_recolor_tree(tree);
+}
+
+/*
+ * Secțiunea pentru oglindirea arborelui
+ * Aceasta va inversa poziția tuturor nodurilor stânga/dreapta
+ * După oglindire, arborele nu mai este arbore de căutare binar (proprietatea BST se pierde)
+ */
+
+/**
+ * Vizitator care schimbă între ei copiii nodului
+ * Fiecare nod își schimbă copiii o singură dată, deci ordinea vizitării nu contează.
+ * Dimensiunea și înălțimea unui subarbore nu se schimbă prin oglindire.
+ * @param tree_node Nodul vizitat
+ * @param context Nefolosit
+ * @return true (parcurgerea continuă)
+ */
+static bool swap_children(BinaryTreeNode * tree_node, void * context) {
+    (void)context;
+    BinaryTreeNode * temp = tree_node->left;
+    tree_node->left = tree_node->right;
+    tree_node->right = temp;
+    return true;
+}
+
+/*
+ * Funcție pentru oglindirea unui nod și a subarborilor săi
+ * Nu mai este recursivă: nodurile de vizitat sunt păstrate într-o stivă explicită
+ * Complexitate: O(n) unde n este numărul de noduri
+ */
+void post_order_mirror(BinaryTreeNode * tree_node) {
+    Stack * stack = create_stack();
+    walk_preorder(stack, tree_node, swap_children, NULL);
+    free_stack(stack);
+}
+
+/*
+ * Funcție pentru oglindirea întregului arbore
+ * Folosește stiva de lucru a arborelui
+ */
+void mirror_tree(BinaryTree * tree) {
+    traverse_tree(tree, TRAVERSAL_VSD, swap_children, NULL);
+}
+
+/*
+ * Funcție pentru eliminarea tuturor nodurilor din arbore
+ * Toate nodurile, cărțile și șirurile provin din blocurile arborelui, deci nu mai este
+ * nevoie de o parcurgere: se eliberează direct blocurile de memorie.
+ * Complexitate: O(numărul de blocuri), nu O(n)
+ */
+void clear_tree(BinaryTree * tree) {
+    // Eliberează blocurile cu noduri, cărți și șiruri
+    slab_release(&tree->node_slab);
+    slab_release(&tree->book_slab);
+    string_pool_release(&tree->strings);
+
+    // Identificatorii autorilor au dispărut odată cu depozitul, deci și indexul după autor
+    free(tree->author_books);
+    tree->author_books = NULL;
+    tree->author_books_capacity = 0;
+    if (tree->year_index) book_index_clear(tree->year_index);
+    if (tree->sales_index) book_index_clear(tree->sales_index);
+
+    // Setează rădăcina la NULL, indicând arbore gol
+    tree->root = NULL;
+    tree->node_count = 0;
+    tree->max_node_count = 0;
+}
+
+/**
+ * Eliberează toată memoria arborelui: nodurile, cărțile, coada și stiva de lucru și structura arborelui
+ * @param tree Arborele care trebuie eliberat
+ */
+void free_tree(BinaryTree * tree) {
+    if (!tree) return;
+    clear_tree(tree);
+    free_queue(tree->queue);
+    free_stack(tree->stack);
+    free_book_index(tree->year_index);
+    free_book_index(tree->sales_index);
+    free(tree);
+}
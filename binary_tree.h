@@ -0,0 +1,241 @@
+/**
+ * Implementarea unui Arbore Binar de Căutare în C
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_BINARY_TREE_H
+#define SDA_LAB4_BINARY_TREE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "queue.h"
+#include "stack.h"
+#include "slab_allocator.h"
+#include "string_pool.h"
+
+/* Constante pentru dimensiunea maximă a șirurilor citite de la tastatură */
+#define MAX_TITLE_LENGTH 128  // Lungimea maximă pentru titlul cărții
+#define MAX_AUTHOR_LENGTH 128 // Lungimea maximă pentru numele autorului
+
+/* Constante pentru marcarea cazurilor când nu s-a găsit un rezultat */
+#define NOT_FOUND_DEPTH -1    // Valoare returnată când nu se poate calcula adâncimea
+#define NOT_FOUND_HEIGHT -1   // Valoare returnată când nu se poate calcula înălțimea
+#define NOT_FOUND_QUANTITY -1 // Tirajul maxim al unui interval fără cărți
+
+/* Numărul de căutări intercalate de get_batch() */
+#define GET_BATCH_GROUP 16
+
+/**
+ * Politica de balansare a arborelui, aleasă la creare
+ */
+typedef enum TreeBalanceMode {
+    TREE_UNBALANCED = 0,               // Arbore de căutare simplu, balansat doar manual cu balance_tree()
+    TREE_AVL,                          // Arbore AVL: se balansează automat la fiecare inserare
+    TREE_RED_BLACK,                    // Arbore roșu-negru: cel mult O(1) rotații la fiecare actualizare
+    TREE_SCAPEGOAT                     // Arbore scapegoat: reconstruiește doar subarborele prea adânc, fără date de balansare în noduri
+} TreeBalanceMode;
+
+/* Culorile nodurilor în modul roșu-negru */
+#define NODE_BLACK 0
+#define NODE_RED 1
+
+/**
+ * Structură pentru stocarea informațiilor despre o carte
+ * Aceasta este structura de date principală stocată în nodurile arborelui.
+ * Titlul și autorul sunt păstrate în depozitul de șiruri al arborelui
+ * (vezi string_pool.h). Cărțile din arbore sunt legate și într-o listă per
+ * autor (indexul după autor), așa că o carte ocupă 48 de octeți.
+ */
+typedef struct Book {
+    int key;                            // Cheia după care se organizează arborele
+    int author_id;                      // Autorul cărții (identificator în depozitul de șiruri)
+    const char * title;                 // Titlul cărții (în depozitul de șiruri)
+    int pub_year;                       // Anul publicării
+    int page_count;                     // Numărul de pagini
+    int quantity_sold;                  // Tirajul (numărul de exemplare vândute)
+    struct Book * prev_by_author;       // Cartea anterioară a aceluiași autor (indexul după autor)
+    struct Book * next_by_author;       // Următoarea carte a aceluiași autor sau NULL
+} Book;
+
+/**
+ * Structură pentru un nod din arborele binar
+ * Conține o referință la o carte și pointeri la copiii din stânga și dreapta.
+ * Cheia este păstrată și direct în nod: căutarea compară doar date din nod
+ * (un singur cache line), iar cartea (48 de octeți) este citită doar la final.
+ * Nodul are 40 de octeți; agregatele tirajului sunt într-un nod extins (AggregateNode).
+ */
+typedef struct BinaryTreeNode {
+    struct BinaryTreeNode * left;      // Pointer la copilul stâng
+    struct BinaryTreeNode * right;     // Pointer la copilul drept
+    Book * book;                       // Referință la obiectul carte stocat în nod
+    int key;                           // Copie a cheii cărții (book->key)
+    int height;                        // Înălțimea subarborelui (actualizată doar în modul AVL)
+    unsigned char color;               // Culoarea nodului (doar în modul roșu-negru), încape în padding
+    unsigned char aggregates;          // 1 dacă nodul este un AggregateNode (cu suma și maximul tirajelor)
+    int size;                          // Numărul de noduri din subarbore (doar cu statistici de ordine), tot în padding
+} BinaryTreeNode;
+
+/**
+ * Nod extins cu agregatele tirajului (56 de octeți)
+ * Doar arborii cu enable_quantity_aggregates() își alocă nodurile cu această
+ * dimensiune, ceilalți nu plătesc cei 16 octeți. Nodul obișnuit este primul
+ * câmp, deci un AggregateNode * poate fi folosit oriunde se cere un BinaryTreeNode *.
+ */
+typedef struct AggregateNode {
+    BinaryTreeNode node;               // Nodul obișnuit (aggregates = 1)
+    int quantity_max;                  // Cel mai mare tiraj din subarbore
+    long long quantity_sum;            // Suma tirajelor din subarbore
+} AggregateNode;
+
+/**
+ * Structură pentru arborele binar
+ * Conține un pointer la rădăcina arborelui
+ */
+typedef struct BinaryTree {
+    BinaryTreeNode * root;             // Pointer la rădăcina arborelui
+    TreeBalanceMode mode;              // Politica de balansare a arborelui
+    size_t node_count;                 // Numărul de noduri din arbore
+    size_t max_node_count;             // Cel mai mare număr de noduri de la ultima reconstruire completă (modul scapegoat)
+    bool order_statistics;             // Nodurile păstrează dimensiunea subarborelui (pentru tree_select/tree_rank)
+    bool quantity_aggregates;          // Nodurile păstrează suma și maximul tirajelor (pentru range_sum/range_max)
+    Queue * queue;                     // Coada refolosită de parcurgerile în lățime
+    Stack * stack;                     // Stiva refolosită de parcurgerile în adâncime
+    SlabAllocator node_slab;           // Blocurile din care se alocă nodurile
+    SlabAllocator book_slab;           // Blocurile din care se alocă cărțile
+    StringPool strings;                // Titlurile și autorii cărților
+    Book ** author_books;              // Prima carte din arbore a fiecărui autor, indexată după author_id
+    int author_books_capacity;         // Capacitatea tabloului author_books
+    struct BookIndex * year_index;     // Indexul după anul publicării (NULL dacă nu este pornit)
+    struct BookIndex * sales_index;    // Indexul după tiraj, pentru top_k() (NULL dacă nu este pornit)
+} BinaryTree;
+
+/**
+ * Ordinea în care traverse_tree() vizitează nodurile
+ */
+typedef enum TraversalOrder {
+    TRAVERSAL_VSD = 0,                 // Preordine (Vârf-Stânga-Dreapta)
+    TRAVERSAL_SVD,                     // Inordine (Stânga-Vârf-Dreapta), chei crescătoare
+    TRAVERSAL_SDV,                     // Postordine (Stânga-Dreapta-Vârf)
+    TRAVERSAL_DFS,                     // În adâncime (la fel ca preordinea)
+    TRAVERSAL_BFS                      // În lățime, nivel cu nivel
+} TraversalOrder;
+
+/**
+ * Funcție apelată de traverse_tree() pentru fiecare nod
+ * Primește nodul și contextul dat de apelant; returnează false pentru a opri parcurgerea.
+ */
+typedef bool (*TreeVisitor)(BinaryTreeNode * tree_node, void * context);
+
+/**
+ * Funcție apelată de interogările indexurilor secundare pentru fiecare carte găsită
+ * Primește cartea și contextul dat de apelant; returnează false pentru a opri parcurgerea.
+ */
+typedef bool (*BookVisitor)(Book * book, void * context);
+
+/**
+ * Structură pentru un nod din lista dublu înlănțuită
+ * Folosită pentru a colecta nodurile în inordine (instantaneele FrozenTree și STree)
+ */
+typedef struct ListNode {
+    struct ListNode * next;         // Pointer la următorul nod din listă
+    struct ListNode * prev;         // Pointer la nodul anterior din listă
+    BinaryTreeNode * tree_node;     // Referință la nodul din arbore
+} ListNode;
+
+/**
+ * Structură pentru lista dublu înlănțuită
+ * Folosită pentru a colecta nodurile în inordine (instantaneele FrozenTree și STree)
+ */
+typedef struct List {
+    ListNode * head;                // Pointer la primul nod din listă
+    ListNode * tail;                // Pointer la ultimul nod din listă
+} List;
+
+/* Crearea și eliberarea arborelui */
+BinaryTree * create_tree(TreeBalanceMode mode);
+BinaryTreeNode * create_tree_node(BinaryTree * tree, Book * book);
+Book * create_book(BinaryTree * tree, int key, char * title, char * author, int pub_year, int page_count, int quantity_sold);
+const char * get_book_author(BinaryTree * tree, Book * book);
+void destroy_tree_node(BinaryTree * tree, BinaryTreeNode * tree_node);
+void clear_tree(BinaryTree * tree);
+void free_tree(BinaryTree * tree);
+
+/* Inserare, căutare și ștergere */
+void insert(BinaryTree * tree, Book * book);
+BinaryTreeNode * get(BinaryTree * tree, int key);
+void get_batch(BinaryTree * tree, const int * keys, size_t count, BinaryTreeNode ** out);
+bool delete_key(BinaryTree * tree, int key);
+
+/* Index după autor */
+Book * find_books_by_author(BinaryTree * tree, const char * author);
+Book * get_author_books(BinaryTree * tree, int author_id);
+
+/* Index după anul publicării */
+void enable_year_index(BinaryTree * tree);
+bool year_range_query(BinaryTree * tree, int from_year, int to_year, BookVisitor visitor, void * context);
+size_t year_range_count(BinaryTree * tree, int from_year, int to_year);
+
+/* Index după tiraj */
+void enable_sales_index(BinaryTree * tree);
+size_t top_k(BinaryTree * tree, size_t k, Book ** out);
+
+/* Rotații folosite de politicile de balansare */
+int node_height(BinaryTreeNode * tree_node);
+int node_size(BinaryTreeNode * tree_node);
+long long node_quantity_sum(BinaryTreeNode * tree_node);
+int node_quantity_max(BinaryTreeNode * tree_node);
+void update_node(BinaryTreeNode * tree_node);
+BinaryTreeNode * rotate_left(BinaryTreeNode * tree_node);
+BinaryTreeNode * rotate_right(BinaryTreeNode * tree_node);
+
+/* Parcurgeri și afișare */
+int get_tree_depth(BinaryTree * tree);
+void display_tree(BinaryTree * tree);
+bool traverse_tree(BinaryTree * tree, TraversalOrder order, TreeVisitor visitor, void * context);
+bool traverse_tree_with(BinaryTree * tree, TraversalOrder order, TreeVisitor visitor, void * context,
+                        Stack * stack, Queue * queue);
+bool range_query(BinaryTree * tree, int lo, int hi, TreeVisitor visitor, void * context);
+bool range_query_with(BinaryTree * tree, int lo, int hi, TreeVisitor visitor, void * context, Stack * stack);
+size_t range_count(BinaryTree * tree, int lo, int hi);
+void VSD(BinaryTreeNode * tree_node);
+void VSD_trasversal(BinaryTree * tree);
+void SVD(BinaryTreeNode * tree_node);
+void SVD_trasversal(BinaryTree * tree);
+void SDV(BinaryTreeNode * tree_node);
+void SDV_trasversal(BinaryTree * tree);
+void DFS(BinaryTree * tree);
+void BFS(BinaryTree * tree);
+
+/* Statistici de ordine */
+void enable_order_statistics(BinaryTree * tree);
+BinaryTreeNode * tree_select(BinaryTree * tree, size_t k);
+size_t tree_rank(BinaryTree * tree, int key);
+
+/* Agregate ale tirajului */
+/* Se pornesc pe arborele gol, înainte de prima inserare: pe un arbore cu noduri returnează false și nu face nimic */
+bool enable_quantity_aggregates(BinaryTree * tree);
+bool update_quantity(BinaryTree * tree, int key, int quantity_sold);
+long long range_sum(BinaryTree * tree, int lo, int hi);
+int range_max(BinaryTree * tree, int lo, int hi);
+
+/* Balansare și liste de noduri în inordine */
+int max(int a, int b);
+int get_node_balance(BinaryTreeNode * tree_node);
+bool is_tree_balanced(BinaryTree * tree);
+ListNode * create_list_node(BinaryTreeNode * tree_node);
+List * create_list(void);
+bool is_list_empty(List * list);
+void list_push_back(List * list, BinaryTreeNode * tree_node);
+void print_list(List * list);
+void populate_list(List * list, BinaryTreeNode * tree_node);
+List * get_tree_nodes_list(BinaryTree * tree);
+void free_list(List * list);
+BinaryTreeNode * rebuild_subtree(BinaryTreeNode * subtree_root);
+void balance_tree(BinaryTree * tree);
+
+/* Oglindire */
+void post_order_mirror(BinaryTreeNode * tree_node);
+void mirror_tree(BinaryTree * tree);
+
+#endif // SDA_LAB4_BINARY_TREE_H
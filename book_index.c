@@ -0,0 +1,301 @@
+/**
+ * Index secundar ordonat după un câmp al cărții (de exemplu anul publicării)
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Indexul este un arbore AVL separat, cu noduri proprii care trimit la aceleași
+ * cărți ca arborele principal. Fiind balansat, înălțimea lui rămâne sub
+ * AVL_MAX_HEIGHT, deci funcțiile recursive de mai jos nu pot epuiza stiva.
+ * Fiecare nod păstrează și dimensiunea subarborelui, astfel încât numărarea
+ * cărților dintr-un interval de valori nu parcurge cărțile.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "book_index.h"
+
+/**
+ * Compară o carte (valoare, cheie, adresă) cu un nod al indexului
+ * @return Negativ, zero sau pozitiv, ca la strcmp
+ */
+static int compare_entry(int value, int key, const Book * book, const BookIndexNode * index_node) {
+    if (value != index_node->value) return value < index_node->value ? -1 : 1;
+    if (key != index_node->key) return key < index_node->key ? -1 : 1;
+    if (book == index_node->book) return 0;
+    return (uintptr_t)book < (uintptr_t)index_node->book ? -1 : 1;
+}
+
+static int index_height(BookIndexNode * index_node) {
+    return index_node ? index_node->height : 0;
+}
+
+static int index_size(BookIndexNode * index_node) {
+    return index_node ? index_node->size : 0;
+}
+
+/**
+ * Recalculează înălțimea și dimensiunea nodului pe baza copiilor
+ * @param index_node Nodul care trebuie actualizat
+ */
+static void index_update(BookIndexNode * index_node) {
+    int left_height = index_height(index_node->left);
+    int right_height = index_height(index_node->right);
+    index_node->height = 1 + (left_height > right_height ? left_height : right_height);
+    index_node->size = 1 + index_size(index_node->left) + index_size(index_node->right);
+}
+
+static BookIndexNode * index_rotate_left(BookIndexNode * index_node) {
+    BookIndexNode * pivot = index_node->right;
+    index_node->right = pivot->left;
+    pivot->left = index_node;
+
+    index_update(index_node);  // Nodul coborât se actualizează primul
+    index_update(pivot);
+    return pivot;
+}
+
+static BookIndexNode * index_rotate_right(BookIndexNode * index_node) {
+    BookIndexNode * pivot = index_node->left;
+    index_node->left = pivot->right;
+    pivot->right = index_node;
+
+    index_update(index_node);
+    index_update(pivot);
+    return pivot;
+}
+
+/**
+ * Actualizează nodul și aplică rotațiile AVL necesare (la fel ca avl_rebalance())
+ * @param index_node Rădăcina subarborelui
+ * @return Noua rădăcină a subarborelui
+ */
+static BookIndexNode * index_rebalance(BookIndexNode * index_node) {
+    index_update(index_node);
+
+    int balance = index_height(index_node->left) - index_height(index_node->right);
+
+    if (balance > 1) {
+        BookIndexNode * left = index_node->left;
+        if (index_height(left->left) < index_height(left->right)) {
+            index_node->left = index_rotate_left(left);
+        }
+        return index_rotate_right(index_node);
+    }
+
+    if (balance < -1) {
+        BookIndexNode * right = index_node->right;
+        if (index_height(right->right) < index_height(right->left)) {
+            index_node->right = index_rotate_right(right);
+        }
+        return index_rotate_left(index_node);
+    }
+
+    return index_node;
+}
+
+/**
+ * Creează un index gol
+ * @param attribute Funcția care extrage din carte valoarea indexată
+ * @return Pointer la noul index
+ */
+BookIndex * create_book_index(BookAttribute attribute) {
+    BookIndex * index = (BookIndex *)malloc(sizeof(BookIndex));
+    index->root = NULL;
+    index->attribute = attribute;
+    index->count = 0;
+    slab_init(&index->node_slab, sizeof(BookIndexNode));
+    return index;
+}
+
+static BookIndexNode * index_insert_at(BookIndexNode * index_node, BookIndexNode * new_node) {
+    if (!index_node) return new_node;
+
+    if (compare_entry(new_node->value, new_node->key, new_node->book, index_node) < 0) {
+        index_node->left = index_insert_at(index_node->left, new_node);
+    } else {
+        index_node->right = index_insert_at(index_node->right, new_node);
+    }
+
+    return index_rebalance(index_node);
+}
+
+/**
+ * Adaugă o carte în index
+ * Complexitate: O(log n)
+ * @param index Indexul
+ * @param book Cartea (rămâne în proprietatea arborelui principal)
+ */
+void book_index_insert(BookIndex * index, Book * book) {
+    BookIndexNode * new_node = (BookIndexNode *)slab_alloc(&index->node_slab);
+    new_node->left = NULL;
+    new_node->right = NULL;
+    new_node->book = book;
+    new_node->value = index->attribute(book);
+    new_node->key = book->key;
+    new_node->height = 1;
+    new_node->size = 1;
+
+    index->root = index_insert_at(index->root, new_node);
+    index->count++;
+}
+
+/**
+ * Scoate cel mai din stânga nod al subarborelui
+ * @param index_node Rădăcina subarborelui
+ * @param minimum Primește nodul scos
+ * @return Noua rădăcină a subarborelui
+ */
+static BookIndexNode * index_remove_min(BookIndexNode * index_node, BookIndexNode ** minimum) {
+    if (!index_node->left) {
+        *minimum = index_node;
+        return index_node->right;
+    }
+
+    index_node->left = index_remove_min(index_node->left, minimum);
+    return index_rebalance(index_node);
+}
+
+static BookIndexNode * index_remove_at(BookIndex * index, BookIndexNode * index_node,
+                                       int value, Book * book, bool * removed) {
+    if (!index_node) return NULL;  // Cartea nu este în index
+
+    int order = compare_entry(value, book->key, book, index_node);
+    if (order < 0) {
+        index_node->left = index_remove_at(index, index_node->left, value, book, removed);
+    } else if (order > 0) {
+        index_node->right = index_remove_at(index, index_node->right, value, book, removed);
+    } else {
+        BookIndexNode * replacement;
+        if (!index_node->left || !index_node->right) {
+            replacement = index_node->left ? index_node->left : index_node->right;
+        } else {
+            // Succesorul ia locul nodului, cu tot cu legăturile lui
+            BookIndexNode * right = index_remove_min(index_node->right, &replacement);
+            replacement->left = index_node->left;
+            replacement->right = right;
+        }
+
+        slab_free(&index->node_slab, index_node);
+        *removed = true;
+        return replacement ? index_rebalance(replacement) : NULL;
+    }
+
+    return index_rebalance(index_node);
+}
+
+/**
+ * Scoate o carte din index
+ * Valoarea indexată a cărții trebuie să fie aceeași ca la inserare.
+ * Complexitate: O(log n)
+ * @param index Indexul
+ * @param book Cartea
+ * @return true dacă cartea a fost găsită și scoasă, false altfel
+ */
+bool book_index_remove(BookIndex * index, Book * book) {
+    bool removed = false;
+    index->root = index_remove_at(index, index->root, index->attribute(book), book, &removed);
+    if (removed) index->count--;
+    return removed;
+}
+
+static bool index_scan_at(BookIndexNode * index_node, int lo, int hi, BookVisitor visitor, void * context) {
+    if (!index_node) return true;
+
+    // Subarborele stâng poate conține valori din interval doar dacă nodul nu este sub lo
+    if (index_node->value >= lo && !index_scan_at(index_node->left, lo, hi, visitor, context)) return false;
+    if (index_node->value >= lo && index_node->value <= hi && !visitor(index_node->book, context)) return false;
+    if (index_node->value <= hi) return index_scan_at(index_node->right, lo, hi, visitor, context);
+    return true;
+}
+
+/**
+ * Vizitează cărțile cu valoarea indexată în [lo, hi], crescător după (valoare, cheie)
+ * Complexitate: O(log n + k), unde k este numărul de cărți vizitate
+ * @param index Indexul
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @param visitor Funcția apelată pentru fiecare carte
+ * @param context Date transmise vizitatorului
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool book_index_scan(BookIndex * index, int lo, int hi, BookVisitor visitor, void * context) {
+    if (lo > hi) return true;
+    return index_scan_at(index->root, lo, hi, visitor, context);
+}
+
+static bool index_scan_reverse_at(BookIndexNode * index_node, int lo, int hi, BookVisitor visitor, void * context) {
+    if (!index_node) return true;
+
+    // Oglinda lui index_scan_at(): întâi subarborele drept
+    if (index_node->value <= hi && !index_scan_reverse_at(index_node->right, lo, hi, visitor, context)) return false;
+    if (index_node->value >= lo && index_node->value <= hi && !visitor(index_node->book, context)) return false;
+    if (index_node->value >= lo) return index_scan_reverse_at(index_node->left, lo, hi, visitor, context);
+    return true;
+}
+
+/**
+ * Vizitează cărțile cu valoarea indexată în [lo, hi], descrescător după (valoare, cheie)
+ * Complexitate: O(log n + k), unde k este numărul de cărți vizitate
+ * @param index Indexul
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @param visitor Funcția apelată pentru fiecare carte
+ * @param context Date transmise vizitatorului
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool book_index_scan_reverse(BookIndex * index, int lo, int hi, BookVisitor visitor, void * context) {
+    if (lo > hi) return true;
+    return index_scan_reverse_at(index->root, lo, hi, visitor, context);
+}
+
+/**
+ * Numără cărțile cu valoarea indexată mai mică decât value (sau egală, cu inclusive)
+ */
+static size_t index_count_below(BookIndex * index, int value, bool inclusive) {
+    size_t count = 0;
+    BookIndexNode * current = index->root;
+
+    while (current) {
+        if (current->value < value || (inclusive && current->value == value)) {
+            count += (size_t)index_size(current->left) + 1;  // Nodul și subarborele stâng sunt înainte
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Numără cărțile cu valoarea indexată în [lo, hi], fără a le parcurge
+ * Complexitate: O(log n)
+ * @param index Indexul
+ * @param lo Capătul stâng al intervalului (inclus)
+ * @param hi Capătul drept al intervalului (inclus)
+ * @return Numărul de cărți
+ */
+size_t book_index_count(BookIndex * index, int lo, int hi) {
+    if (lo > hi) return 0;
+    return index_count_below(index, hi, true) - index_count_below(index, lo, false);
+}
+
+/**
+ * Golește indexul; cărțile nu sunt atinse
+ * @param index Indexul
+ */
+void book_index_clear(BookIndex * index) {
+    slab_release(&index->node_slab);
+    index->root = NULL;
+    index->count = 0;
+}
+
+/**
+ * Eliberează indexul
+ * @param index Indexul (poate fi NULL)
+ */
+void free_book_index(BookIndex * index) {
+    if (!index) return;
+    book_index_clear(index);
+    free(index);
+}
@@ -0,0 +1,55 @@
+/**
+ * Index secundar ordonat după un câmp al cărții (de exemplu anul publicării)
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_BOOK_INDEX_H
+#define SDA_LAB4_BOOK_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "binary_tree.h"
+#include "slab_allocator.h"
+
+/**
+ * Funcție care extrage din carte valoarea după care este ordonat indexul
+ */
+typedef int (*BookAttribute)(const Book * book);
+
+/**
+ * Structură pentru un nod al indexului
+ * Valoarea și cheia sunt copiate din carte, ca la căutare să fie citit doar nodul.
+ */
+typedef struct BookIndexNode {
+    struct BookIndexNode * left;       // Pointer la copilul stâng
+    struct BookIndexNode * right;      // Pointer la copilul drept
+    Book * book;                       // Cartea din arborele principal (nu este copiată)
+    int value;                         // Valoarea câmpului indexat
+    int key;                           // Cheia cărții, departajează valorile egale
+    int height;                        // Înălțimea subarborelui (balansare AVL)
+    int size;                          // Numărul de noduri din subarbore (pentru numărări)
+} BookIndexNode;
+
+/**
+ * Structură pentru indexul secundar
+ * Un arbore AVL ordonat după (valoare, cheie, adresa cărții), care împarte cărțile
+ * cu arborele principal; adresa face ordinea strictă și pentru cheile duplicate.
+ */
+typedef struct BookIndex {
+    BookIndexNode * root;              // Rădăcina arborelui indexului
+    BookAttribute attribute;           // Câmpul indexat
+    size_t count;                      // Numărul de cărți din index
+    SlabAllocator node_slab;           // Blocurile din care se alocă nodurile
+} BookIndex;
+
+BookIndex * create_book_index(BookAttribute attribute);
+void book_index_insert(BookIndex * index, Book * book);
+bool book_index_remove(BookIndex * index, Book * book);
+bool book_index_scan(BookIndex * index, int lo, int hi, BookVisitor visitor, void * context);
+bool book_index_scan_reverse(BookIndex * index, int lo, int hi, BookVisitor visitor, void * context);
+size_t book_index_count(BookIndex * index, int lo, int hi);
+void book_index_clear(BookIndex * index);
+void free_book_index(BookIndex * index);
+
+#endif // SDA_LAB4_BOOK_INDEX_H
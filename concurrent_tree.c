@@ -0,0 +1,174 @@
+/**
+ * Acces concurent la arborele binar: mai mulți cititori sau un singur scriitor
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * get() doar citește nodurile, iar parcurgerile folosesc stiva sau coada firului
+ * apelant în locul celor din arbore, așa că oricâte citiri pot rula în paralel
+ * sub zăvorul de citire. Funcțiile care pornesc la cerere indexuri sau agregate
+ * (top_k(), year_range_query(), tree_select() ...) modifică arborele și trebuie
+ * apelate doar cu acces exclusiv.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "concurrent_tree.h"
+
+/**
+ * Creează un arbore gol, protejat de un zăvor cititori-scriitor
+ * @param mode Politica de balansare
+ * @return Pointer la noul arbore
+ */
+ConcurrentTree * create_concurrent_tree(TreeBalanceMode mode) {
+    ConcurrentTree * concurrent = (ConcurrentTree *)malloc(sizeof(ConcurrentTree));
+    concurrent->tree = create_tree(mode);
+
+    pthread_rwlockattr_t attributes;
+    pthread_rwlockattr_init(&attributes);
+#ifdef __GLIBC__
+    // Implicit glibc preferă cititorii: cu căutări continue un scriitor ar aștepta la nesfârșit
+    pthread_rwlockattr_setkind_np(&attributes, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+    pthread_rwlock_init(&concurrent->lock, &attributes);
+    pthread_rwlockattr_destroy(&attributes);
+    return concurrent;
+}
+
+/**
+ * Eliberează arborele; niciun alt fir nu trebuie să îl mai folosească
+ * @param concurrent Arborele (poate fi NULL)
+ */
+void free_concurrent_tree(ConcurrentTree * concurrent) {
+    if (!concurrent) return;
+    pthread_rwlock_destroy(&concurrent->lock);
+    free_tree(concurrent->tree);
+    free(concurrent);
+}
+
+/**
+ * Creează și inserează o carte
+ * Cartea se creează sub zăvor, pentru că titlul și autorul intră în depozitul de șiruri al arborelui.
+ */
+void concurrent_insert(ConcurrentTree * concurrent, int key, char * title, char * author,
+                       int pub_year, int page_count, int quantity_sold) {
+    pthread_rwlock_wrlock(&concurrent->lock);
+    BinaryTree * tree = concurrent->tree;
+    insert(tree, create_book(tree, key, title, author, pub_year, page_count, quantity_sold));
+    pthread_rwlock_unlock(&concurrent->lock);
+}
+
+/**
+ * Șterge cartea cu cheia dată
+ * @return true dacă cartea a fost găsită și ștearsă, false altfel
+ */
+bool concurrent_delete(ConcurrentTree * concurrent, int key) {
+    pthread_rwlock_wrlock(&concurrent->lock);
+    bool deleted = delete_key(concurrent->tree, key);
+    pthread_rwlock_unlock(&concurrent->lock);
+    return deleted;
+}
+
+/**
+ * Balansează arborele; cititorii așteaptă până la terminarea reconstruirii
+ */
+void concurrent_balance(ConcurrentTree * concurrent) {
+    pthread_rwlock_wrlock(&concurrent->lock);
+    balance_tree(concurrent->tree);
+    pthread_rwlock_unlock(&concurrent->lock);
+}
+
+/**
+ * Oglindește arborele cu acces exclusiv
+ */
+void concurrent_mirror(ConcurrentTree * concurrent) {
+    pthread_rwlock_wrlock(&concurrent->lock);
+    mirror_tree(concurrent->tree);
+    pthread_rwlock_unlock(&concurrent->lock);
+}
+
+/**
+ * Golește arborele cu acces exclusiv
+ */
+void concurrent_clear(ConcurrentTree * concurrent) {
+    pthread_rwlock_wrlock(&concurrent->lock);
+    clear_tree(concurrent->tree);
+    pthread_rwlock_unlock(&concurrent->lock);
+}
+
+/**
+ * Copiază o carte pentru un cititor care eliberează zăvorul imediat după
+ * Legăturile indexului după autor pot fi schimbate de un scriitor, iar locul titlului
+ * este refolosit după ștergerea cărții, așa că legăturile devin NULL și titlul este
+ * copiat în bufferul apelantului (trunchiat la MAX_TITLE_LENGTH - 1 caractere).
+ * @param book Cartea din arbore (citită sub zăvor)
+ * @param out Primește copia
+ * @param title Buffer de MAX_TITLE_LENGTH caractere pentru titlu (poate fi NULL; atunci out->title este NULL)
+ */
+void snapshot_book(const Book * book, Book * out, char * title) {
+    *out = *book;
+    out->prev_by_author = NULL;
+    out->next_by_author = NULL;
+    out->title = NULL;
+
+    if (title) {
+        size_t length = string_pool_length(book->title);
+        if (length > MAX_TITLE_LENGTH - 1) length = MAX_TITLE_LENGTH - 1;
+        memcpy(title, book->title, length);
+        title[length] = '\0';
+        out->title = title;
+    }
+}
+
+/**
+ * Caută o carte și o copiază în out
+ * Nodul poate fi șters de un scriitor imediat după eliberarea zăvorului, așa că
+ * se returnează o copie (vezi snapshot_book()), nu un pointer.
+ * @param concurrent Arborele
+ * @param key Cheia căutată
+ * @param out Primește cartea găsită (poate fi NULL dacă interesează doar existența)
+ * @param title Buffer de MAX_TITLE_LENGTH caractere pentru titlu (poate fi NULL)
+ * @return true dacă cartea a fost găsită, false altfel
+ */
+bool concurrent_get(ConcurrentTree * concurrent, int key, Book * out, char * title) {
+    pthread_rwlock_rdlock(&concurrent->lock);
+    BinaryTreeNode * tree_node = get(concurrent->tree, key);
+    if (tree_node && out) snapshot_book(tree_node->book, out, title);
+    pthread_rwlock_unlock(&concurrent->lock);
+    return tree_node != NULL;
+}
+
+/**
+ * Parcurge arborele în paralel cu alte citiri, cu stiva sau coada apelantului
+ * Fiecare fir cititor își păstrează stiva și coada și le refolosește, deci o
+ * parcurgere nu face alocări. Vizitatorul rulează sub zăvorul de citire și nu trebuie
+ * să modifice arborele.
+ * @param stack Stiva firului (poate fi NULL pentru TRAVERSAL_BFS); este golită aici
+ * @param queue Coada firului (poate fi NULL în celelalte ordini); este golită aici
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool concurrent_traverse_with(ConcurrentTree * concurrent, TraversalOrder order, TreeVisitor visitor, void * context,
+                              Stack * stack, Queue * queue) {
+    // O parcurgere oprită de vizitator lasă noduri în stivă sau în coadă
+    if (stack) stack_clear(stack);
+    if (queue) queue_clear(queue);
+
+    pthread_rwlock_rdlock(&concurrent->lock);
+    bool finished = traverse_tree_with(concurrent->tree, order, visitor, context, stack, queue);
+    pthread_rwlock_unlock(&concurrent->lock);
+    return finished;
+}
+
+/**
+ * Vizitează nodurile din intervalul [lo, hi] în paralel cu alte citiri, cu stiva apelantului
+ * @param stack Stiva firului; este golită aici
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool concurrent_range_query_with(ConcurrentTree * concurrent, int lo, int hi, TreeVisitor visitor, void * context,
+                                 Stack * stack) {
+    stack_clear(stack);
+
+    pthread_rwlock_rdlock(&concurrent->lock);
+    bool finished = range_query_with(concurrent->tree, lo, hi, visitor, context, stack);
+    pthread_rwlock_unlock(&concurrent->lock);
+    return finished;
+}
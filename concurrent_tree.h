@@ -0,0 +1,49 @@
+/**
+ * Acces concurent la arborele binar: mai mulți cititori sau un singur scriitor
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_CONCURRENT_TREE_H
+#define SDA_LAB4_CONCURRENT_TREE_H
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "binary_tree.h"
+
+/**
+ * Structură pentru arborele partajat între fire
+ * Căutările și parcurgerile iau zăvorul în mod citire și rulează în paralel;
+ * inserarea, ștergerea, balansarea, oglindirea și golirea îl iau în mod scriere.
+ * Cititorii nu folosesc stiva și coada arborelui, ci pe cele primite de la firul
+ * apelant (create o dată și refolosite), deci nu modifică nimic în arbore.
+ */
+typedef struct ConcurrentTree {
+    BinaryTree * tree;                 // Arborele protejat
+    pthread_rwlock_t lock;             // Zăvorul cititori-scriitor
+} ConcurrentTree;
+
+ConcurrentTree * create_concurrent_tree(TreeBalanceMode mode);
+void free_concurrent_tree(ConcurrentTree * concurrent);
+
+/* Scriitori: acces exclusiv */
+void concurrent_insert(ConcurrentTree * concurrent, int key, char * title, char * author,
+                       int pub_year, int page_count, int quantity_sold);
+bool concurrent_delete(ConcurrentTree * concurrent, int key);
+void concurrent_balance(ConcurrentTree * concurrent);
+void concurrent_mirror(ConcurrentTree * concurrent);
+void concurrent_clear(ConcurrentTree * concurrent);
+
+/*
+ * Cititori: rulează simultan
+ * concurrent_get() copiază cartea fără legăturile prev_by_author/next_by_author, iar
+ * titlul în bufferul apelantului: locul titlului din arbore este refolosit după ștergere.
+ */
+void snapshot_book(const Book * book, Book * out, char * title);
+bool concurrent_get(ConcurrentTree * concurrent, int key, Book * out, char * title);
+bool concurrent_traverse_with(ConcurrentTree * concurrent, TraversalOrder order, TreeVisitor visitor, void * context,
+                              Stack * stack, Queue * queue);
+bool concurrent_range_query_with(ConcurrentTree * concurrent, int lo, int hi, TreeVisitor visitor, void * context,
+                                 Stack * stack);
+
+#endif // SDA_LAB4_CONCURRENT_TREE_H
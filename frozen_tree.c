@@ -0,0 +1,143 @@
+/**
+ * Instantaneu doar pentru citire al arborelui, în aranjament Eytzinger
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Instantaneul păstrează pointeri la cărțile arborelui, deci este valid doar
+ * până la următoarea modificare sau curățare a arborelui; după o serie de
+ * scrieri se reconstruiește cu freeze_tree().
+ */
+
+#include <stdlib.h>
+
+#include "frozen_tree.h"
+
+/* Dimensiunea unei linii de cache, în octeți */
+#define CACHE_LINE_SIZE 64
+
+/* Câte chei de tip int încap într-o linie de cache */
+#define KEYS_PER_CACHE_LINE (CACHE_LINE_SIZE / sizeof(int))
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FROZEN_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define FROZEN_PREFETCH(address) ((void)0)
+#endif
+
+/**
+ * Alocă un tablou de int aliniat la linia de cache
+ * @param count Numărul de elemente
+ * @return Tabloul alocat
+ */
+static int * alloc_cache_aligned(size_t count) {
+    size_t bytes = count * sizeof(int);
+    bytes = (bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    return (int *)aligned_alloc(CACHE_LINE_SIZE, bytes);
+}
+
+/**
+ * Așază cheile sortate în aranjament Eytzinger printr-o parcurgere în inordine a pozițiilor
+ * @param frozen Instantaneul construit
+ * @param sorted_keys Cheile în ordine crescătoare
+ * @param next Indicele următoarei chei sortate
+ * @param position Poziția curentă în tabloul Eytzinger
+ * @return Indicele următoarei chei sortate după completarea subarborelui
+ */
+static size_t eytzinger_fill(FrozenTree * frozen, int * sorted_keys, size_t next, size_t position) {
+    if (position > frozen->size) return next;
+
+    next = eytzinger_fill(frozen, sorted_keys, next, 2 * position);
+    frozen->keys[position] = sorted_keys[next];
+    frozen->book_index[position] = (int)next;
+    next++;
+    return eytzinger_fill(frozen, sorted_keys, next, 2 * position + 1);
+}
+
+/**
+ * Construiește un instantaneu doar pentru citire al arborelui
+ * Nodurile sunt colectate în inordine (ordinea SVD), apoi cheile sunt rearanjate.
+ * Complexitate: O(n)
+ * @param tree Arborele
+ * @return Instantaneul construit
+ */
+FrozenTree * freeze_tree(BinaryTree * tree) {
+    List * nodes = get_tree_nodes_list(tree);
+
+    size_t size = 0;
+    for (ListNode * head = nodes->head; head; head = head->next) size++;
+
+    FrozenTree * frozen = (FrozenTree *)malloc(sizeof(FrozenTree));
+    frozen->size = size;
+    frozen->keys = alloc_cache_aligned(size + 1);
+    frozen->book_index = (int *)malloc((size + 1) * sizeof(int));
+    frozen->books = (Book **)malloc((size ? size : 1) * sizeof(Book *));
+
+    int * sorted_keys = (int *)malloc((size ? size : 1) * sizeof(int));
+    size_t i = 0;
+    for (ListNode * head = nodes->head; head; head = head->next, i++) {
+        sorted_keys[i] = head->tree_node->key;
+        frozen->books[i] = head->tree_node->book;
+    }
+    free_list(nodes);
+
+    eytzinger_fill(frozen, sorted_keys, 0, 1);
+    free(sorted_keys);
+
+    return frozen;
+}
+
+/**
+ * Găsește prima cheie mai mare sau egală cu cheia dată
+ * Fiecare pas alege copilul prin aritmetică (fără ramificații), iar descendenții
+ * de pe 4 nivele mai jos, aflați într-o singură linie de cache, sunt preîncărcați.
+ * Complexitate: O(log n)
+ * @param frozen Instantaneul
+ * @param key Cheia căutată
+ * @return Indicele cărții în frozen->books sau frozen->size dacă nu există o astfel de cheie
+ */
+long frozen_lower_bound(FrozenTree * frozen, int key) {
+    const int * keys = frozen->keys;
+    size_t size = frozen->size;
+    size_t position = 1;
+
+    while (position <= size) {
+        FROZEN_PREFETCH(keys + position * KEYS_PER_CACHE_LINE);
+        position = 2 * position + (keys[position] < key);
+    }
+
+    // Eliminăm pașii la dreapta de la final și încă un pas la stânga:
+    // rămâne ultimul nod unde am mers la stânga, adică primul element >= key
+#if defined(__GNUC__) || defined(__clang__)
+    position >>= __builtin_ffsll((long long)~position);
+#else
+    while (position & 1) position >>= 1;
+    position >>= 1;
+#endif
+
+    return position ? frozen->book_index[position] : (long)size;
+}
+
+/**
+ * Caută o carte după cheie în instantaneu
+ * @param frozen Instantaneul
+ * @param key Cheia căutată
+ * @return Cartea găsită sau NULL dacă nu există
+ */
+Book * frozen_get(FrozenTree * frozen, int key) {
+    long index = frozen_lower_bound(frozen, key);
+    if (index == (long)frozen->size) return NULL;
+
+    Book * book = frozen->books[index];
+    return book->key == key ? book : NULL;
+}
+
+/**
+ * Eliberează instantaneul (cărțile rămân în arbore)
+ * @param frozen Instantaneul
+ */
+void free_frozen_tree(FrozenTree * frozen) {
+    if (!frozen) return;
+    free(frozen->keys);
+    free(frozen->book_index);
+    free(frozen->books);
+    free(frozen);
+}
@@ -0,0 +1,35 @@
+/**
+ * Instantaneu doar pentru citire al arborelui, în aranjament Eytzinger
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_FROZEN_TREE_H
+#define SDA_LAB4_FROZEN_TREE_H
+
+#include <stddef.h>
+
+#include "binary_tree.h"
+
+/* Valoare returnată când o cheie nu există în instantaneu */
+#define NOT_FOUND_INDEX -1
+
+/**
+ * Structură pentru instantaneul înghețat al arborelui
+ * Cheile sunt păstrate într-un tablou în ordinea parcurgerii în lățime a unui
+ * arbore binar complet (aranjament Eytzinger, indexat de la 1): copiii poziției k
+ * sunt 2k și 2k+1. Primele nivele încap în câteva linii de cache și pot fi
+ * preîncărcate înainte de a fi necesare, iar căutarea nu are ramificații.
+ */
+typedef struct FrozenTree {
+    int * keys;                        // Cheile în aranjament Eytzinger (poziția 0 nefolosită)
+    int * book_index;                  // Pentru fiecare poziție, indicele cărții în books
+    Book ** books;                     // Cărțile în ordinea crescătoare a cheilor
+    size_t size;                       // Numărul de chei
+} FrozenTree;
+
+FrozenTree * freeze_tree(BinaryTree * tree);
+long frozen_lower_bound(FrozenTree * frozen, int key);
+Book * frozen_get(FrozenTree * frozen, int key);
+void free_frozen_tree(FrozenTree * frozen);
+
+#endif // SDA_LAB4_FROZEN_TREE_H
@@ -0,0 +1,289 @@
+/**
+ * Arbore de căutare cu zăvoare optimiste per nod (optimistic lock coupling)
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Fiecare nod are un număr de versiune care servește și ca zăvor. Un fir care
+ * coboară în arbore nu blochează nimic: citește versiunea nodului, citește
+ * copilul, apoi verifică că versiunea nu s-a schimbat (altfel o ia de la capăt).
+ * Doar inserarea blochează, și numai nodul de care se leagă nodul nou, trecând
+ * versiunea citită direct în starea blocat; dacă între timp nodul s-a schimbat,
+ * inserarea reîncepe. Inserările în subarbori diferiți nu se ating deloc.
+ *
+ * Arborele nu se balansează (ca TREE_UNBALANCED) și nu are ștergere: un nod
+ * scos ar putea fi încă citit de alt fir, deci ar avea nevoie de reclamarea pe
+ * epoci din persistent_tree.c. Nodurile sunt alocate cu malloc, care poate fi
+ * apelat din mai multe fire, spre deosebire de slab-urile arborelui principal.
+ * Titlul este copiat în nod, iar autorii sunt internați într-o tabelă în care
+ * se adaugă prin compare-and-swap, deci niciun pas nu ia un mutex.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#include "olc_tree.h"
+
+/**
+ * Așteaptă până când nodul nu este blocat și returnează versiunea lui
+ * Un scriitor ține zăvorul doar câteva instrucțiuni; dacă a fost întrerupt, cedăm procesorul.
+ */
+static uint64_t read_version(OlcNode * node) {
+    uint64_t version;
+    while ((version = atomic_load_explicit(&node->version, memory_order_acquire)) & OLC_LOCKED) {
+        sched_yield();
+    }
+    return version;
+}
+
+/**
+ * Verifică că nodul nu a fost modificat de când a fost citită versiunea
+ */
+static bool validate(OlcNode * node, uint64_t version) {
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&node->version, memory_order_relaxed) == version;
+}
+
+/**
+ * Creează un arbore gol
+ * @return Pointer la noul arbore
+ */
+OlcTree * create_olc_tree(void) {
+    OlcTree * olc = (OlcTree *)malloc(sizeof(OlcTree));
+    atomic_init(&olc->anchor.version, 0);
+    atomic_init(&olc->anchor.left, NULL);
+    atomic_init(&olc->anchor.right, NULL);
+    olc->anchor.key = 0;
+    olc->anchor.author = NULL;
+    for (int i = 0; i < OLC_AUTHOR_BUCKETS; i++) atomic_init(&olc->authors[i], NULL);
+    atomic_init(&olc->author_count, 0);
+    return olc;
+}
+
+/**
+ * Eliberează arborele; niciun alt fir nu trebuie să îl mai folosească
+ * Nodurile sunt eliberate prin rotații spre dreapta, fără stivă și fără recursivitate,
+ * pentru că arborele nebalansat poate fi oricât de adânc.
+ * @param olc Arborele (poate fi NULL)
+ */
+void free_olc_tree(OlcTree * olc) {
+    if (!olc) return;
+
+    OlcNode * node = atomic_load_explicit(&olc->anchor.left, memory_order_relaxed);
+    while (node) {
+        OlcNode * left = atomic_load_explicit(&node->left, memory_order_relaxed);
+        if (left) {
+            // Rotim copilul stâng deasupra nodului
+            atomic_store_explicit(&node->left, atomic_load_explicit(&left->right, memory_order_relaxed), memory_order_relaxed);
+            atomic_store_explicit(&left->right, node, memory_order_relaxed);
+            node = left;
+        } else {
+            OlcNode * right = atomic_load_explicit(&node->right, memory_order_relaxed);
+            free(node);
+            node = right;
+        }
+    }
+
+    for (int i = 0; i < OLC_AUTHOR_BUCKETS; i++) {
+        OlcAuthor * author = atomic_load_explicit(&olc->authors[i], memory_order_relaxed);
+        while (author) {
+            OlcAuthor * next = author->next;
+            free(author);
+            author = next;
+        }
+    }
+    free(olc);
+}
+
+/**
+ * Funcția de dispersie FNV-1a pentru numele autorilor
+ */
+static uint32_t author_hash(const char * name) {
+    uint32_t hash = 2166136261u;
+    for (const unsigned char * c = (const unsigned char *)name; *c; c++) {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Caută un autor în lista care începe cu first, până la (fără) stop
+ * @return Autorul găsit sau NULL
+ */
+static OlcAuthor * find_author(OlcAuthor * first, OlcAuthor * stop, const char * name) {
+    for (OlcAuthor * author = first; author != stop; author = author->next) {
+        if (strcmp(author->name, name) == 0) return author;
+    }
+    return NULL;
+}
+
+/**
+ * Returnează intrarea autorului, adăugând-o dacă lipsește; poate fi apelată din mai multe fire
+ * Intrarea nouă este pusă la începutul listei prin compare-and-swap. Dacă alt fir a
+ * schimbat între timp începutul listei, se caută doar printre intrările adăugate de
+ * el (același autor poate fi printre ele) și se reîncearcă. Un fir care pierde cursa
+ * pentru același nume își eliberează intrarea, deci identificatorii sunt unici, dar
+ * pot avea goluri.
+ * @param olc Arborele
+ * @param name Numele autorului
+ * @return Intrarea autorului
+ */
+static const OlcAuthor * intern_author(OlcTree * olc, const char * name) {
+    _Atomic(OlcAuthor *) * bucket = &olc->authors[author_hash(name) & (OLC_AUTHOR_BUCKETS - 1)];
+    OlcAuthor * head = atomic_load_explicit(bucket, memory_order_acquire);
+    OlcAuthor * found = find_author(head, NULL, name);
+    if (found) return found;
+
+    size_t length = strlen(name);
+    OlcAuthor * author = (OlcAuthor *)malloc(sizeof(OlcAuthor) + length + 1);
+    memcpy(author->name, name, length + 1);
+    author->id = atomic_fetch_add_explicit(&olc->author_count, 1, memory_order_relaxed);
+
+    while (true) {
+        author->next = head;
+        if (atomic_compare_exchange_weak_explicit(bucket, &head, author,
+                                                  memory_order_release, memory_order_acquire)) {
+            return author;
+        }
+
+        // head este acum noul început al listei; autorii dinaintea vechiului început sunt noi
+        found = find_author(head, author->next, name);
+        if (found) {
+            free(author);
+            return found;
+        }
+    }
+}
+
+/**
+ * Returnează legătura spre copilul în care continuă căutarea cheii
+ */
+static _Atomic(OlcNode *) * child_link(OlcTree * olc, OlcNode * node, int key) {
+    if (node == &olc->anchor) return &node->left;
+    return node->key > key ? &node->left : &node->right;  // Cheile egale merg la dreapta
+}
+
+/**
+ * O încercare de inserare; eșuează dacă un nod de pe drum s-a schimbat între timp
+ * @return true dacă nodul a fost legat, false dacă inserarea trebuie reluată
+ */
+static bool try_insert(OlcTree * olc, OlcNode * new_node) {
+    OlcNode * parent = &olc->anchor;
+    uint64_t version = read_version(parent);
+
+    while (true) {
+        _Atomic(OlcNode *) * link = child_link(olc, parent, new_node->key);
+        OlcNode * child = atomic_load_explicit(link, memory_order_acquire);
+        if (!validate(parent, version)) return false;
+
+        if (!child) {
+            // Blocăm părintele doar dacă nu s-a schimbat de la citire
+            if (!atomic_compare_exchange_strong_explicit(&parent->version, &version, version + OLC_LOCKED,
+                                                         memory_order_acquire, memory_order_relaxed)) {
+                return false;
+            }
+            atomic_store_explicit(link, new_node, memory_order_release);
+            atomic_store_explicit(&parent->version, version + 2, memory_order_release);
+            return true;
+        }
+
+        // Cuplarea: versiunea copilului se citește înainte de a verifica din nou părintele
+        uint64_t child_version = read_version(child);
+        if (!validate(parent, version)) return false;
+
+        parent = child;
+        version = child_version;
+    }
+}
+
+/**
+ * Creează și inserează o carte; poate fi apelată simultan din mai multe fire
+ * Titlul este copiat în nod, iar autorul este internat în tabela arborelui.
+ * Complexitate: O(h), plus reluările cauzate de inserări în același loc
+ * @param olc Arborele
+ * @param key Cheia cărții
+ * @param title Titlul cărții
+ * @param author Autorul cărții
+ * @param pub_year Anul publicării
+ * @param page_count Numărul de pagini
+ * @param quantity_sold Tirajul
+ */
+void olc_insert(OlcTree * olc, int key, char * title, char * author,
+                int pub_year, int page_count, int quantity_sold) {
+    size_t title_length = strlen(title);
+    OlcNode * new_node = (OlcNode *)malloc(sizeof(OlcNode) + title_length + 1);
+    atomic_init(&new_node->version, 0);
+    atomic_init(&new_node->left, NULL);
+    atomic_init(&new_node->right, NULL);
+    new_node->key = key;
+    new_node->author = intern_author(olc, author);
+    char * stored_title = (char *)(new_node + 1);  // Imediat după nod
+    memcpy(stored_title, title, title_length + 1);
+
+    Book * book = &new_node->book;
+    book->title = stored_title;
+    book->author_id = new_node->author->id;
+    book->key = key;
+    book->pub_year = pub_year;
+    book->page_count = page_count;
+    book->quantity_sold = quantity_sold;
+    book->prev_by_author = NULL;  // Arborele OLC nu are index după autor
+    book->next_by_author = NULL;
+
+    while (!try_insert(olc, new_node)) {
+        // Un alt fir a modificat drumul: reluăm de la rădăcină
+    }
+}
+
+/**
+ * O încercare de căutare; eșuează dacă un nod de pe drum s-a schimbat între timp
+ * @return true dacă rezultatul este valid, false dacă căutarea trebuie reluată
+ */
+static bool try_get(OlcTree * olc, int key, const Book ** result) {
+    OlcNode * parent = &olc->anchor;
+    uint64_t version = read_version(parent);
+
+    while (true) {
+        OlcNode * child = atomic_load_explicit(child_link(olc, parent, key), memory_order_acquire);
+        if (!validate(parent, version)) return false;
+
+        if (!child || child->key == key) {
+            *result = child ? &child->book : NULL;  // NULL: nu există nod cu cheia specificată
+            return true;
+        }
+
+        uint64_t child_version = read_version(child);
+        if (!validate(parent, version)) return false;
+
+        parent = child;
+        version = child_version;
+    }
+}
+
+/**
+ * Caută o cheie fără a bloca nimic; poate rula simultan cu inserări
+ * @param olc Arborele
+ * @param key Cheia căutată
+ * @return Cartea găsită (validă cât timp există arborele) sau NULL
+ */
+const Book * olc_get(OlcTree * olc, int key) {
+    const Book * result;
+    while (!try_get(olc, key, &result)) {
+        // Un scriitor a modificat drumul: reluăm de la rădăcină
+    }
+    return result;
+}
+
+/**
+ * Returnează numele autorului unei cărți din arbore, fără zăvor
+ * Cartea este în interiorul nodului, iar nodul păstrează intrarea autorului, care
+ * nu se mută și rămâne validă cât timp există arborele.
+ * @param olc Arborele
+ * @param book Cartea (returnată de olc_get())
+ * @return Numele autorului
+ */
+const char * olc_get_author(OlcTree * olc, const Book * book) {
+    (void)olc;
+    const OlcNode * node = (const OlcNode *)((const char *)book - offsetof(OlcNode, book));
+    return node->author->name;
+}
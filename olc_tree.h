@@ -0,0 +1,67 @@
+/**
+ * Arbore de căutare cu zăvoare optimiste per nod (optimistic lock coupling)
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_OLC_TREE_H
+#define SDA_LAB4_OLC_TREE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "binary_tree.h"
+
+/* Bitul de blocare din versiunea unui nod; versiunea crește cu 2 la fiecare modificare */
+#define OLC_LOCKED 1
+
+/* Numărul de liste din tabela de autori (putere a lui 2) */
+#define OLC_AUTHOR_BUCKETS 1024
+
+/**
+ * Structură pentru un autor din tabela arborelui
+ * Intrarea nu se mai schimbă după ce este publicată în lista ei, deci poate fi
+ * citită fără zăvor; este eliberată doar odată cu arborele.
+ */
+typedef struct OlcAuthor {
+    struct OlcAuthor * next;           // Următorul autor din aceeași listă
+    int id;                            // Identificatorul autorului (book->author_id)
+    char name[];                       // Numele autorului
+} OlcAuthor;
+
+/**
+ * Structură pentru un nod al arborelui
+ * Versiunea este impară cât timp un scriitor modifică legăturile nodului.
+ * Cheia, cartea, autorul și titlul nu se mai schimbă după inserare.
+ * Titlul este copiat imediat după nod, în aceeași alocare, și book.title indică acolo.
+ */
+typedef struct OlcNode {
+    _Atomic uint64_t version;          // Versiunea nodului (bitul 0 = blocat)
+    _Atomic(struct OlcNode *) left;    // Pointer la copilul stâng
+    _Atomic(struct OlcNode *) right;   // Pointer la copilul drept
+    int key;                           // Cheia cărții
+    const OlcAuthor * author;          // Autorul cărții (din tabela arborelui)
+    Book book;                         // Copie a cărții
+} OlcNode;
+
+/**
+ * Structură pentru arbore
+ * Rădăcina este copilul stâng al nodului santinelă anchor, ca inserarea în
+ * arborele gol să blocheze tot un nod, la fel ca oricare altă inserare.
+ * Autorii sunt internați într-o tabelă de liste în care se adaugă doar prin
+ * compare-and-swap, așa că nici inserarea, nici citirea numelui nu iau un zăvor.
+ */
+typedef struct OlcTree {
+    OlcNode anchor;                    // Santinela: anchor.left este rădăcina
+    _Atomic(OlcAuthor *) authors[OLC_AUTHOR_BUCKETS];  // Listele de autori, după dispersia numelui
+    atomic_int author_count;           // Următorul identificator de autor
+} OlcTree;
+
+OlcTree * create_olc_tree(void);
+void free_olc_tree(OlcTree * olc);
+void olc_insert(OlcTree * olc, int key, char * title, char * author,
+                int pub_year, int page_count, int quantity_sold);
+const Book * olc_get(OlcTree * olc, int key);
+const char * olc_get_author(OlcTree * olc, const Book * book);
+
+#endif // SDA_LAB4_OLC_TREE_H
@@ -0,0 +1,426 @@
+/**
+ * Arbore persistent (copiere pe drum) cu cititori care nu se blochează niciodată
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Scriitorul nu modifică niciodată un nod publicat: copiază nodurile de pe drumul
+ * de la rădăcină la locul modificării (și pe cele atinse de rotații), construiește
+ * astfel o versiune nouă și o publică printr-o singură scriere atomică a rădăcinii.
+ * Un cititor citește rădăcina o dată și vede până la capăt o versiune consistentă,
+ * chiar dacă între timp scriitorul publică altele, inclusiv o reconstruire completă
+ * făcută de persistent_balance().
+ *
+ * Nodurile și cărțile înlocuite nu pot fi eliberate imediat, pentru că un cititor
+ * poate fi încă în versiunea veche. Fiecare cititor anunță epoca globală la intrare;
+ * un obiect scos în epoca e este eliberat doar când niciun cititor activ nu a
+ * anunțat o epocă mai mică sau egală cu e. Reclamarea o face tot scriitorul, după
+ * fiecare publicare, deci slab-urile sunt folosite de un singur fir.
+ *
+ * Arborele este balansat AVL, așa că funcțiile recursive de mai jos au adâncimea
+ * sub AVL_MAX_HEIGHT.
+ */
+
+#include <stdlib.h>
+
+#include "persistent_tree.h"
+
+/**
+ * Creează un arbore persistent gol
+ * @return Pointer la noul arbore
+ */
+PersistentTree * create_persistent_tree(void) {
+    PersistentTree * persistent = (PersistentTree *)malloc(sizeof(PersistentTree));
+    atomic_init(&persistent->root, NULL);
+    atomic_init(&persistent->epoch, 1);  // Epoca 0 înseamnă „cititor inactiv”
+    for (int i = 0; i < PERSISTENT_MAX_READERS; i++) {
+        atomic_init(&persistent->readers[i].epoch, 0);
+        atomic_init(&persistent->readers[i].used, false);
+    }
+    pthread_mutex_init(&persistent->write_lock, NULL);
+    persistent->version = 0;
+    persistent->node_count = 0;
+    persistent->retired = NULL;
+    persistent->retired_count = 0;
+    persistent->retired_capacity = 0;
+    slab_init(&persistent->node_slab, sizeof(PersistentNode));
+    slab_init(&persistent->book_slab, sizeof(Book));
+    string_pool_init(&persistent->strings);
+    return persistent;
+}
+
+/**
+ * Eliberează arborele; niciun alt fir nu trebuie să îl mai folosească
+ * @param persistent Arborele (poate fi NULL)
+ */
+void free_persistent_tree(PersistentTree * persistent) {
+    if (!persistent) return;
+    slab_release(&persistent->node_slab);
+    slab_release(&persistent->book_slab);
+    string_pool_release(&persistent->strings);
+    free(persistent->retired);
+    pthread_mutex_destroy(&persistent->write_lock);
+    free(persistent);
+}
+
+/**
+ * Scoate un obiect din arbore: este eliberat imediat dacă nu a fost publicat niciodată,
+ * altfel așteaptă în lista obiectelor scoase
+ * @param persistent Arborele
+ * @param object Nodul sau cartea
+ * @param is_book true pentru o carte
+ */
+static void retire(PersistentTree * persistent, void * object, bool is_book) {
+    if (!is_book && ((PersistentNode *)object)->version == persistent->version) {
+        slab_free(&persistent->node_slab, object);  // Creat și abandonat în aceeași operație
+        return;
+    }
+
+    if (persistent->retired_count == persistent->retired_capacity) {
+        persistent->retired_capacity = persistent->retired_capacity ? persistent->retired_capacity * 2 : 64;
+        persistent->retired = (RetiredObject *)realloc(persistent->retired,
+                                                       persistent->retired_capacity * sizeof(RetiredObject));
+    }
+
+    RetiredObject * retired = &persistent->retired[persistent->retired_count++];
+    retired->object = object;
+    retired->is_book = is_book;
+    retired->epoch = atomic_load(&persistent->epoch);
+}
+
+/**
+ * Eliberează obiectele scoase pe care niciun cititor activ nu le mai poate vedea
+ * @param persistent Arborele
+ */
+static void reclaim(PersistentTree * persistent) {
+    // Cea mai mică epocă anunțată de un cititor activ
+    uint64_t oldest = UINT64_MAX;
+    for (int i = 0; i < PERSISTENT_MAX_READERS; i++) {
+        uint64_t epoch = atomic_load(&persistent->readers[i].epoch);
+        if (epoch != 0 && epoch < oldest) oldest = epoch;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < persistent->retired_count; i++) {
+        RetiredObject retired = persistent->retired[i];
+        if (retired.epoch < oldest) {
+            slab_free(retired.is_book ? &persistent->book_slab : &persistent->node_slab, retired.object);
+        } else {
+            persistent->retired[kept++] = retired;
+        }
+    }
+    persistent->retired_count = kept;
+}
+
+/**
+ * Începe o operație de scriere: nodurile create de acum sunt ale ei și pot fi modificate pe loc
+ */
+static void begin_write(PersistentTree * persistent) {
+    pthread_mutex_lock(&persistent->write_lock);
+    persistent->version++;
+}
+
+/**
+ * Publică noua versiune, avansează epoca și eliberează ce se poate
+ * @param persistent Arborele
+ * @param root Rădăcina noii versiuni
+ */
+static void end_write(PersistentTree * persistent, PersistentNode * root) {
+    atomic_store(&persistent->root, root);
+    atomic_fetch_add(&persistent->epoch, 1);  // Cine anunță de acum epoca nouă vede deja noua rădăcină
+    reclaim(persistent);
+    pthread_mutex_unlock(&persistent->write_lock);
+}
+
+static PersistentNode * create_persistent_node(PersistentTree * persistent, Book * book, int key) {
+    PersistentNode * node = (PersistentNode *)slab_alloc(&persistent->node_slab);
+    node->left = NULL;
+    node->right = NULL;
+    node->book = book;
+    node->key = key;
+    node->height = 1;
+    node->version = persistent->version;
+    return node;
+}
+
+/**
+ * Returnează un nod care poate fi modificat în operația curentă
+ * Un nod publicat este copiat, iar originalul este scos din arbore.
+ */
+static PersistentNode * mutable_node(PersistentTree * persistent, PersistentNode * node) {
+    if (node->version == persistent->version) return node;
+
+    PersistentNode * copy = create_persistent_node(persistent, node->book, node->key);
+    copy->left = node->left;
+    copy->right = node->right;
+    copy->height = node->height;
+    retire(persistent, node, false);
+    return copy;
+}
+
+static int persistent_height(PersistentNode * node) {
+    return node ? node->height : 0;
+}
+
+static void persistent_update(PersistentNode * node) {
+    node->height = 1 + max(persistent_height(node->left), persistent_height(node->right));
+}
+
+/* Rotațiile primesc un nod deja modificabil și copiază pivotul înainte de a-l schimba */
+static PersistentNode * persistent_rotate_left(PersistentTree * persistent, PersistentNode * node) {
+    PersistentNode * pivot = mutable_node(persistent, node->right);
+    node->right = pivot->left;
+    pivot->left = node;
+
+    persistent_update(node);
+    persistent_update(pivot);
+    return pivot;
+}
+
+static PersistentNode * persistent_rotate_right(PersistentTree * persistent, PersistentNode * node) {
+    PersistentNode * pivot = mutable_node(persistent, node->left);
+    node->left = pivot->right;
+    pivot->right = node;
+
+    persistent_update(node);
+    persistent_update(pivot);
+    return pivot;
+}
+
+/**
+ * Actualizează un nod modificabil și aplică rotațiile AVL necesare (la fel ca avl_rebalance())
+ */
+static PersistentNode * persistent_rebalance(PersistentTree * persistent, PersistentNode * node) {
+    persistent_update(node);
+
+    int balance = persistent_height(node->left) - persistent_height(node->right);
+
+    if (balance > 1) {
+        if (persistent_height(node->left->left) < persistent_height(node->left->right)) {
+            node->left = persistent_rotate_left(persistent, mutable_node(persistent, node->left));
+        }
+        return persistent_rotate_right(persistent, node);
+    }
+
+    if (balance < -1) {
+        if (persistent_height(node->right->right) < persistent_height(node->right->left)) {
+            node->right = persistent_rotate_right(persistent, mutable_node(persistent, node->right));
+        }
+        return persistent_rotate_left(persistent, node);
+    }
+
+    return node;
+}
+
+static PersistentNode * persistent_insert_at(PersistentTree * persistent, PersistentNode * node, PersistentNode * new_node) {
+    if (!node) return new_node;
+
+    PersistentNode * copy = mutable_node(persistent, node);
+    if (copy->key > new_node->key) {
+        copy->left = persistent_insert_at(persistent, copy->left, new_node);
+    } else {
+        copy->right = persistent_insert_at(persistent, copy->right, new_node);  // Cheile egale merg la dreapta
+    }
+
+    return persistent_rebalance(persistent, copy);
+}
+
+/**
+ * Creează o carte și o inserează într-o versiune nouă a arborelui
+ * Complexitate: O(log n) noduri copiate
+ */
+void persistent_insert(PersistentTree * persistent, int key, char * title, char * author,
+                       int pub_year, int page_count, int quantity_sold) {
+    begin_write(persistent);
+
+    Book * book = (Book *)slab_alloc(&persistent->book_slab);
+    book->key = key;
+    book->title = string_pool_store(&persistent->strings, title);
+    book->author_id = string_pool_intern(&persistent->strings, author);
+    book->pub_year = pub_year;
+    book->page_count = page_count;
+    book->quantity_sold = quantity_sold;
+    book->prev_by_author = NULL;  // Arborele persistent nu are index după autor
+    book->next_by_author = NULL;
+
+    PersistentNode * root = atomic_load(&persistent->root);
+    root = persistent_insert_at(persistent, root, create_persistent_node(persistent, book, key));
+    persistent->node_count++;
+
+    end_write(persistent, root);
+}
+
+/**
+ * Scoate cel mai din stânga nod al subarborelui, copiind drumul spre el
+ * @param minimum Primește nodul scos (încă publicat, nu este eliberat aici)
+ */
+static PersistentNode * persistent_remove_min(PersistentTree * persistent, PersistentNode * node, PersistentNode ** minimum) {
+    if (!node->left) {
+        *minimum = node;
+        return node->right;
+    }
+
+    PersistentNode * copy = mutable_node(persistent, node);
+    copy->left = persistent_remove_min(persistent, copy->left, minimum);
+    return persistent_rebalance(persistent, copy);
+}
+
+static PersistentNode * persistent_delete_at(PersistentTree * persistent, PersistentNode * node, int key, bool * removed) {
+    if (!node) return NULL;  // Cheia nu există: nimic nu este copiat
+
+    if (node->key != key) {
+        bool go_left = node->key > key;
+        PersistentNode * child = persistent_delete_at(persistent, go_left ? node->left : node->right, key, removed);
+        if (!*removed) return node;
+
+        PersistentNode * copy = mutable_node(persistent, node);
+        if (go_left) copy->left = child; else copy->right = child;
+        return persistent_rebalance(persistent, copy);
+    }
+
+    *removed = true;
+    retire(persistent, node->book, true);
+
+    if (!node->left || !node->right) {
+        PersistentNode * child = node->left ? node->left : node->right;
+        retire(persistent, node, false);
+        return child;
+    }
+
+    // Nodul cu doi copii primește cartea succesorului, iar succesorul dispare
+    PersistentNode * successor;
+    PersistentNode * right = persistent_remove_min(persistent, node->right, &successor);
+    PersistentNode * copy = mutable_node(persistent, node);
+    copy->book = successor->book;
+    copy->key = successor->key;
+    copy->right = right;
+    retire(persistent, successor, false);
+    return persistent_rebalance(persistent, copy);
+}
+
+/**
+ * Șterge cartea cu cheia dată într-o versiune nouă a arborelui
+ * Cititorii aflați în versiunea veche pot vedea cartea până ies din arbore.
+ * @return true dacă cartea a fost găsită și ștearsă, false altfel
+ */
+bool persistent_delete(PersistentTree * persistent, int key) {
+    begin_write(persistent);
+
+    bool removed = false;
+    PersistentNode * root = persistent_delete_at(persistent, atomic_load(&persistent->root), key, &removed);
+    if (removed) persistent->node_count--;
+
+    end_write(persistent, root);
+    return removed;
+}
+
+static void collect_nodes(PersistentNode * node, PersistentNode ** nodes, size_t * count) {
+    if (!node) return;
+    collect_nodes(node->left, nodes, count);
+    nodes[(*count)++] = node;
+    collect_nodes(node->right, nodes, count);
+}
+
+static PersistentNode * build_balanced(PersistentTree * persistent, PersistentNode ** nodes, size_t from, size_t to) {
+    if (from >= to) return NULL;
+
+    size_t middle = from + (to - from) / 2;
+    PersistentNode * node = create_persistent_node(persistent, nodes[middle]->book, nodes[middle]->key);
+    node->left = build_balanced(persistent, nodes, from, middle);
+    node->right = build_balanced(persistent, nodes, middle + 1, to);
+    persistent_update(node);
+    return node;
+}
+
+/**
+ * Reconstruiește arborele perfect balansat, ca o versiune nouă
+ * Spre deosebire de balance_tree(), nodurile existente nu sunt legate altfel:
+ * se construiește o copie completă, iar cititorii continuă între timp în versiunea veche.
+ * Complexitate: O(n) timp și O(n) memorie suplimentară până la reclamare
+ */
+void persistent_balance(PersistentTree * persistent) {
+    begin_write(persistent);
+
+    PersistentNode * root = atomic_load(&persistent->root);
+    PersistentNode ** nodes = (PersistentNode **)malloc((persistent->node_count ? persistent->node_count : 1) * sizeof(PersistentNode *));
+    size_t count = 0;
+    collect_nodes(root, nodes, &count);
+
+    root = build_balanced(persistent, nodes, 0, count);
+    for (size_t i = 0; i < count; i++) retire(persistent, nodes[i], false);
+    free(nodes);
+
+    end_write(persistent, root);
+}
+
+/**
+ * Înregistrează firul curent ca cititor
+ * @return Locul cititorului sau NOT_FOUND_READER dacă toate locurile sunt ocupate
+ */
+int persistent_register_reader(PersistentTree * persistent) {
+    for (int i = 0; i < PERSISTENT_MAX_READERS; i++) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&persistent->readers[i].used, &expected, true)) return i;
+    }
+    return NOT_FOUND_READER;
+}
+
+/**
+ * Eliberează locul unui cititor
+ */
+void persistent_unregister_reader(PersistentTree * persistent, int reader) {
+    atomic_store(&persistent->readers[reader].epoch, 0);
+    atomic_store(&persistent->readers[reader].used, false);
+}
+
+/**
+ * Intră în arbore: anunță epoca, apoi citește rădăcina publicată
+ * Ordinea contează: scriitorul care nu vede încă anunțul a publicat deja noua rădăcină.
+ */
+static PersistentNode * reader_enter(PersistentTree * persistent, int reader) {
+    atomic_store(&persistent->readers[reader].epoch, atomic_load(&persistent->epoch));
+    return atomic_load(&persistent->root);
+}
+
+static void reader_exit(PersistentTree * persistent, int reader) {
+    atomic_store(&persistent->readers[reader].epoch, 0);
+}
+
+/**
+ * Caută o carte fără să aștepte scriitorii
+ * @param persistent Arborele
+ * @param reader Locul obținut cu persistent_register_reader()
+ * @param key Cheia căutată
+ * @param out Primește o copie a cărții (poate fi NULL)
+ * @return true dacă cartea a fost găsită, false altfel
+ */
+bool persistent_get(PersistentTree * persistent, int reader, int key, Book * out) {
+    PersistentNode * node = reader_enter(persistent, reader);
+    while (node && node->key != key) {
+        node = (node->key > key) ? node->left : node->right;
+    }
+
+    if (node && out) *out = *node->book;
+    reader_exit(persistent, reader);
+    return node != NULL;
+}
+
+static bool persistent_scan(PersistentNode * node, int lo, int hi, BookVisitor visitor, void * context) {
+    if (!node) return true;
+    if (node->key >= lo && !persistent_scan(node->left, lo, hi, visitor, context)) return false;
+    if (node->key >= lo && node->key <= hi && !visitor(node->book, context)) return false;
+    if (node->key <= hi) return persistent_scan(node->right, lo, hi, visitor, context);
+    return true;
+}
+
+/**
+ * Vizitează crescător cărțile cu cheile în [lo, hi], toate din aceeași versiune a arborelui
+ * Scrierile publicate în timpul parcurgerii nu sunt văzute și nu o opresc.
+ * Cărțile primite de vizitator sunt valide doar în timpul apelului.
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool persistent_range_query(PersistentTree * persistent, int reader, int lo, int hi,
+                            BookVisitor visitor, void * context) {
+    PersistentNode * root = reader_enter(persistent, reader);
+    bool finished = lo > hi || persistent_scan(root, lo, hi, visitor, context);
+    reader_exit(persistent, reader);
+    return finished;
+}
@@ -0,0 +1,95 @@
+/**
+ * Arbore persistent (copiere pe drum) cu cititori care nu se blochează niciodată
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_PERSISTENT_TREE_H
+#define SDA_LAB4_PERSISTENT_TREE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "binary_tree.h"
+#include "slab_allocator.h"
+#include "string_pool.h"
+
+/* Numărul maxim de fire cititoare înregistrate simultan */
+#define PERSISTENT_MAX_READERS 64
+
+/* Valoare returnată când nu mai există locuri libere pentru cititori */
+#define NOT_FOUND_READER -1
+
+/**
+ * Structură pentru un nod al arborelui persistent
+ * După publicare nodul nu mai este modificat: scriitorul copiază drumul și
+ * publică o rădăcină nouă, iar nodurile înlocuite sunt eliberate mai târziu.
+ */
+typedef struct PersistentNode {
+    struct PersistentNode * left;      // Pointer la copilul stâng
+    struct PersistentNode * right;     // Pointer la copilul drept
+    Book * book;                       // Cartea (împărțită între versiunile arborelui)
+    int key;                           // Copie a cheii cărții
+    int height;                        // Înălțimea subarborelui (balansare AVL)
+    uint64_t version;                  // Operația de scriere care a creat nodul
+} PersistentNode;
+
+/**
+ * Locul unui cititor: epoca în care a intrat în arbore sau 0 dacă nu citește
+ * Fiecare loc ocupă un cache line, ca cititorii să nu își invalideze reciproc liniile.
+ */
+typedef struct PersistentReaderSlot {
+    _Alignas(64) _Atomic uint64_t epoch;   // Epoca anunțată de cititor (0 = în afara arborelui)
+    _Atomic bool used;                     // Locul aparține unui fir
+} PersistentReaderSlot;
+
+/**
+ * Obiect scos din arbore care așteaptă să nu mai fie văzut de niciun cititor
+ */
+typedef struct RetiredObject {
+    void * object;                     // Nodul sau cartea
+    bool is_book;                      // Cartea se întoarce în alt slab decât nodul
+    uint64_t epoch;                    // Epoca în care a fost scos
+} RetiredObject;
+
+/**
+ * Structură pentru arborele persistent
+ * Scriitorii sunt serializați de un mutex; cititorii doar anunță epoca și citesc
+ * rădăcina curentă, fără zăvoare și fără operații care să aștepte scriitorul.
+ * Un obiect scos în epoca e este eliberat când toți cititorii activi au anunțat
+ * o epocă mai mare decât e (reclamare bazată pe epoci).
+ */
+typedef struct PersistentTree {
+    _Atomic(PersistentNode *) root;    // Versiunea publicată a arborelui
+    _Atomic uint64_t epoch;            // Epoca globală, crește după fiecare publicare
+    PersistentReaderSlot readers[PERSISTENT_MAX_READERS];
+    pthread_mutex_t write_lock;        // Serializează scriitorii
+    uint64_t version;                  // Numărul operației de scriere curente
+    size_t node_count;                 // Numărul de cărți din versiunea publicată
+    RetiredObject * retired;           // Obiectele care așteaptă eliberarea
+    size_t retired_count;              // Numărul de obiecte care așteaptă
+    size_t retired_capacity;           // Capacitatea tabloului retired
+    SlabAllocator node_slab;           // Blocurile pentru noduri (folosite doar de scriitor)
+    SlabAllocator book_slab;           // Blocurile pentru cărți
+    StringPool strings;                // Titlurile și autorii cărților
+} PersistentTree;
+
+PersistentTree * create_persistent_tree(void);
+void free_persistent_tree(PersistentTree * persistent);
+
+/* Scriitori (serializați între ei, nu blochează cititorii) */
+void persistent_insert(PersistentTree * persistent, int key, char * title, char * author,
+                       int pub_year, int page_count, int quantity_sold);
+bool persistent_delete(PersistentTree * persistent, int key);
+void persistent_balance(PersistentTree * persistent);
+
+/* Cititori */
+int persistent_register_reader(PersistentTree * persistent);
+void persistent_unregister_reader(PersistentTree * persistent, int reader);
+bool persistent_get(PersistentTree * persistent, int reader, int key, Book * out);
+bool persistent_range_query(PersistentTree * persistent, int reader, int lo, int hi,
+                            BookVisitor visitor, void * context);
+
+#endif // SDA_LAB4_PERSISTENT_TREE_H
@@ -0,0 +1,124 @@
+/**
+ * Coadă circulară (ring buffer) pentru parcurgerile în lățime ale arborelui
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "queue.h"
+#include "binary_tree.h"
+
+/**
+ * Creează o nouă coadă goală
+ * @return Pointer la noua coadă creată
+ */
+Queue * create_queue(void) {
+    Queue * queue = (Queue *)malloc(sizeof(Queue));
+    queue->capacity = QUEUE_INITIAL_CAPACITY;
+    queue->items = (BinaryTreeNode **)malloc(queue->capacity * sizeof(BinaryTreeNode *));
+    queue->head = 0;
+    queue->tail = 0;
+    queue->size = 0;
+    return queue;
+}
+
+/**
+ * Eliberează memoria cozii și a tabloului de elemente
+ * @param queue Coada care trebuie eliberată
+ */
+void free_queue(Queue * queue) {
+    if (!queue) return;
+    free(queue->items);
+    free(queue);
+}
+
+/**
+ * Golește coada fără a elibera tabloul, pentru a-l refolosi la următorul apel
+ * @param queue Coada care trebuie golită
+ */
+void queue_clear(Queue * queue) {
+    queue->head = 0;
+    queue->tail = 0;
+    queue->size = 0;
+}
+
+/**
+ * Dublează capacitatea cozii
+ * Elementele sunt copiate în ordine la începutul noului tablou,
+ * deci coada circulară se "desface" în timpul creșterii.
+ * @param queue Coada care trebuie extinsă
+ */
+static void queue_grow(Queue * queue) {
+    size_t old_capacity = queue->capacity;
+    size_t new_capacity = old_capacity * 2;
+    BinaryTreeNode ** items = (BinaryTreeNode **)malloc(new_capacity * sizeof(BinaryTreeNode *));
+
+    // Copiem cele două segmente ale cozii: [head, sfârșit) și [0, tail)
+    size_t start = queue->head & (old_capacity - 1);
+    size_t first_part = old_capacity - start;
+    if (first_part > (size_t)queue->size) first_part = (size_t)queue->size;
+
+    memcpy(items, queue->items + start, first_part * sizeof(BinaryTreeNode *));
+    memcpy(items + first_part, queue->items, ((size_t)queue->size - first_part) * sizeof(BinaryTreeNode *));
+
+    free(queue->items);
+    queue->items = items;
+    queue->capacity = new_capacity;
+    queue->head = 0;
+    queue->tail = (size_t)queue->size;
+}
+
+/**
+ * Adaugă un nod din arbore la sfârșitul cozii
+ * Complexitate: O(1) amortizat
+ * @param queue Coada în care se va adăuga nodul
+ * @param tree_node Nodul din arbore care va fi adăugat în coadă
+ */
+void enqueue(Queue * queue, BinaryTreeNode * tree_node) {
+    // Extindem tabloul dacă este plin
+    if ((size_t)queue->size == queue->capacity) queue_grow(queue);
+
+    queue->items[queue->tail & (queue->capacity - 1)] = tree_node;
+    queue->tail++;
+    queue->size++;  // Incrementăm dimensiunea cozii
+}
+
+/**
+ * Elimină și returnează primul nod din coadă
+ * Complexitate: O(1)
+ * @param queue Coada din care se va elimina nodul
+ * @return Nodul din arbore care era primul în coadă sau NULL dacă coada este goală
+ */
+BinaryTreeNode * dequeue(Queue * queue) {
+    // Cazul special: coada este goală
+    if (queue->size == 0) {
+        return NULL;
+    }
+
+    BinaryTreeNode * tree_node = queue->items[queue->head & (queue->capacity - 1)];
+    queue->head++;
+    queue->size--;  // Decrementăm dimensiunea cozii
+
+    return tree_node;
+}
+
+/**
+ * Verifică dacă coada este goală
+ * @param queue Coada care trebuie verificată
+ * @return true dacă coada este goală, false în caz contrar
+ */
+bool is_queue_empty(Queue * queue) {
+    return queue->size == 0;
+}
+
+/**
+ * Afișează titlurile cărților din nodurile stocate în coadă
+ * @param queue Coada care trebuie afișată
+ */
+void display_queue(Queue * queue) {
+    for (size_t i = queue->head; i != queue->tail; i++) {
+        printf("%s ", queue->items[i & (queue->capacity - 1)]->book->title);
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * Coadă circulară (ring buffer) pentru parcurgerile în lățime ale arborelui
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_QUEUE_H
+#define SDA_LAB4_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Capacitatea inițială a cozii (trebuie să fie o putere a lui 2) */
+#define QUEUE_INITIAL_CAPACITY 64
+
+struct BinaryTreeNode;
+
+/**
+ * Structură pentru coadă
+ * Elementele sunt păstrate într-un tablou contiguu de dimensiune putere a lui 2,
+ * astfel încât poziția se calculează cu o mască în loc de operația modulo.
+ * Coada crește prin dublare și nu se micșorează, deci poate fi refolosită
+ * între apeluri fără alocări noi.
+ */
+typedef struct Queue {
+    struct BinaryTreeNode ** items;    // Tabloul circular cu elementele cozii
+    size_t capacity;                   // Capacitatea tabloului (putere a lui 2)
+    size_t head;                       // Indicele (nemascat) primului element
+    size_t tail;                       // Indicele (nemascat) după ultimul element
+    int size;                          // Dimensiunea cozii
+} Queue;
+
+Queue * create_queue(void);
+void free_queue(Queue * queue);
+void queue_clear(Queue * queue);
+void enqueue(Queue * queue, struct BinaryTreeNode * tree_node);
+struct BinaryTreeNode * dequeue(Queue * queue);
+bool is_queue_empty(Queue * queue);
+void display_queue(Queue * queue);
+
+#endif // SDA_LAB4_QUEUE_H
@@ -0,0 +1,306 @@
+/**
+ * Politica de balansare roșu-negru pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Nodurile nu au pointer la părinte, deci drumul de la rădăcină este păstrat
+ * într-un tablou pe stivă. O inserare face cel mult două rotații, iar o ștergere
+ * cel mult trei; restul reparațiilor sunt doar recolorări.
+ */
+
+#include <stdlib.h>
+
+#include "rb_tree.h"
+
+/**
+ * Verifică dacă un nod este roșu (subarborii vizi sunt considerați negri)
+ * @param tree_node Nodul verificat (poate fi NULL)
+ * @return true dacă nodul există și este roșu
+ */
+static bool is_red(BinaryTreeNode * tree_node) {
+    return tree_node && tree_node->color == NODE_RED;
+}
+
+/**
+ * Înlocuiește copilul unui nod (sau rădăcina arborelui) cu un alt subarbore
+ * @param tree Arborele
+ * @param parent Părintele subarborelui înlocuit sau NULL pentru rădăcină
+ * @param old_child Subarborele vechi
+ * @param new_child Subarborele nou
+ */
+static void replace_child(BinaryTree * tree, BinaryTreeNode * parent,
+                          BinaryTreeNode * old_child, BinaryTreeNode * new_child) {
+    if (!parent) {
+        tree->root = new_child;
+    } else if (parent->left == old_child) {
+        parent->left = new_child;
+    } else {
+        parent->right = new_child;
+    }
+}
+
+/**
+ * Inserează un nod nou în arborele roșu-negru și repară proprietățile de culoare
+ * Cheile egale sunt trimise la dreapta, la fel ca în insert() pentru arborele simplu.
+ * Complexitate: O(log n), cel mult două rotații
+ * @param tree Arborele în care se inserează
+ * @param new_node Nodul care va fi inserat
+ */
+void rb_insert_node(BinaryTree * tree, BinaryTreeNode * new_node) {
+    BinaryTreeNode * path[RB_MAX_HEIGHT];
+    int depth = 0;
+    int key = new_node->key;
+
+    new_node->color = NODE_RED;
+
+    // Cazul special: arborele este gol
+    if (!tree->root) {
+        new_node->color = NODE_BLACK;
+        tree->root = new_node;
+        return;
+    }
+
+    // Coborâm până la poziția de inserare, memorând strămoșii
+    BinaryTreeNode * root = tree->root;
+    while (true) {
+        path[depth++] = root;
+        if (root->key > key) {
+            if (!root->left) {
+                root->left = new_node;
+                break;
+            }
+            root = root->left;
+        } else {
+            if (!root->right) {
+                root->right = new_node;
+                break;
+            }
+            root = root->right;
+        }
+    }
+
+    // Reparăm cazul "părinte roșu - copil roșu"; părintele roșu nu poate fi rădăcina
+    BinaryTreeNode * node = new_node;
+    int parent_index = depth - 1;
+    while (parent_index > 0 && is_red(path[parent_index])) {
+        BinaryTreeNode * parent = path[parent_index];
+        BinaryTreeNode * grand = path[parent_index - 1];
+        BinaryTreeNode * great = parent_index >= 2 ? path[parent_index - 2] : NULL;
+
+        if (parent == grand->left) {
+            BinaryTreeNode * uncle = grand->right;
+
+            // Unchiul roșu: doar recolorăm și continuăm de la bunic
+            if (is_red(uncle)) {
+                parent->color = NODE_BLACK;
+                uncle->color = NODE_BLACK;
+                grand->color = NODE_RED;
+                node = grand;
+                parent_index -= 2;
+                continue;
+            }
+
+            // Cazul stânga-dreapta se reduce la stânga-stânga
+            if (node == parent->right) grand->left = rotate_left(parent);
+
+            grand->left->color = NODE_BLACK;
+            grand->color = NODE_RED;
+            replace_child(tree, great, grand, rotate_right(grand));
+        } else {
+            BinaryTreeNode * uncle = grand->left;
+
+            // Unchiul roșu: doar recolorăm și continuăm de la bunic
+            if (is_red(uncle)) {
+                parent->color = NODE_BLACK;
+                uncle->color = NODE_BLACK;
+                grand->color = NODE_RED;
+                node = grand;
+                parent_index -= 2;
+                continue;
+            }
+
+            // Cazul dreapta-stânga se reduce la dreapta-dreapta
+            if (node == parent->left) grand->right = rotate_right(parent);
+
+            grand->right->color = NODE_BLACK;
+            grand->color = NODE_RED;
+            replace_child(tree, great, grand, rotate_left(grand));
+        }
+        break;
+    }
+
+    tree->root->color = NODE_BLACK;
+}
+
+/**
+ * Repară proprietatea înălțimii negre după eliminarea unui nod negru
+ * Poziția "dublu neagră" este copilul lui path[depth - 1] din partea indicată de is_left.
+ * @param tree Arborele
+ * @param path Drumul de la rădăcină până la părintele poziției dublu negre
+ * @param depth Numărul de noduri din drum
+ * @param is_left true dacă poziția dublu neagră este copilul stâng
+ */
+static void rb_delete_fixup(BinaryTree * tree, BinaryTreeNode ** path, int depth, bool is_left) {
+    while (depth > 0) {
+        BinaryTreeNode * parent = path[depth - 1];
+        BinaryTreeNode * great = depth >= 2 ? path[depth - 2] : NULL;
+
+        if (is_left) {
+            BinaryTreeNode * sibling = parent->right;
+
+            // Fratele roșu: o rotație îl transformă într-un frate negru
+            if (is_red(sibling)) {
+                sibling->color = NODE_BLACK;
+                parent->color = NODE_RED;
+                replace_child(tree, great, parent, rotate_left(parent));
+                path[depth - 1] = sibling;
+                path[depth++] = parent;
+                great = sibling;
+                sibling = parent->right;
+            }
+
+            // Fratele negru cu copii negri: recolorăm și urcăm
+            if (!is_red(sibling->left) && !is_red(sibling->right)) {
+                sibling->color = NODE_RED;
+                if (parent->color == NODE_RED) {
+                    parent->color = NODE_BLACK;
+                    return;
+                }
+                depth--;
+                if (depth > 0) is_left = path[depth - 1]->left == parent;
+                continue;
+            }
+
+            // Copilul roșu al fratelui trebuie să fie cel exterior
+            if (!is_red(sibling->right)) {
+                sibling->left->color = NODE_BLACK;
+                sibling->color = NODE_RED;
+                parent->right = rotate_right(sibling);
+                sibling = parent->right;
+            }
+
+            sibling->color = parent->color;
+            parent->color = NODE_BLACK;
+            sibling->right->color = NODE_BLACK;
+            replace_child(tree, great, parent, rotate_left(parent));
+            return;
+        } else {
+            BinaryTreeNode * sibling = parent->left;
+
+            // Fratele roșu: o rotație îl transformă într-un frate negru
+            if (is_red(sibling)) {
+                sibling->color = NODE_BLACK;
+                parent->color = NODE_RED;
+                replace_child(tree, great, parent, rotate_right(parent));
+                path[depth - 1] = sibling;
+                path[depth++] = parent;
+                great = sibling;
+                sibling = parent->left;
+            }
+
+            // Fratele negru cu copii negri: recolorăm și urcăm
+            if (!is_red(sibling->left) && !is_red(sibling->right)) {
+                sibling->color = NODE_RED;
+                if (parent->color == NODE_RED) {
+                    parent->color = NODE_BLACK;
+                    return;
+                }
+                depth--;
+                if (depth > 0) is_left = path[depth - 1]->left == parent;
+                continue;
+            }
+
+            // Copilul roșu al fratelui trebuie să fie cel exterior
+            if (!is_red(sibling->left)) {
+                sibling->right->color = NODE_BLACK;
+                sibling->color = NODE_RED;
+                parent->left = rotate_left(sibling);
+                sibling = parent->left;
+            }
+
+            sibling->color = parent->color;
+            parent->color = NODE_BLACK;
+            sibling->left->color = NODE_BLACK;
+            replace_child(tree, great, parent, rotate_right(parent));
+            return;
+        }
+    }
+}
+
+/**
+ * Șterge din arborele roșu-negru nodul cu cheia specificată și eliberează cartea lui
+ * Complexitate: O(log n), cel mult trei rotații
+ * @param tree Arborele din care se șterge
+ * @param key Cheia nodului care trebuie șters
+ * @return true dacă nodul a fost găsit și șters, false în caz contrar
+ */
+bool rb_delete(BinaryTree * tree, int key) {
+    // Drumul poate crește cu un nod în timpul reparației (cazul fratelui roșu)
+    BinaryTreeNode * path[RB_MAX_HEIGHT + 2];
+    int depth = 0;
+
+    // Căutăm nodul, memorând strămoșii
+    BinaryTreeNode * target = tree->root;
+    while (target && target->key != key) {
+        path[depth++] = target;
+        target = (target->key > key) ? target->left : target->right;
+    }
+
+    if (!target) return false;  // Nu există nod cu cheia specificată
+
+    // Un nod cu doi copii își preia cartea succesorului, iar succesorul este eliminat
+    BinaryTreeNode * removed = target;
+    if (target->left && target->right) {
+        path[depth++] = target;
+        removed = target->right;
+        while (removed->left) {
+            path[depth++] = removed;
+            removed = removed->left;
+        }
+
+        Book * temp = target->book;
+        target->book = removed->book;
+        removed->book = temp;
+        target->key = removed->key;
+    }
+
+    // Nodul eliminat are cel mult un copil, care îi ia locul
+    BinaryTreeNode * child = removed->left ? removed->left : removed->right;
+    BinaryTreeNode * parent = depth > 0 ? path[depth - 1] : NULL;
+    bool is_left = parent && parent->left == removed;
+    replace_child(tree, parent, removed, child);
+
+    // Eliminarea unui nod negru scade înălțimea neagră pe acest drum
+    if (removed->color == NODE_BLACK) {
+        if (is_red(child)) {
+            child->color = NODE_BLACK;
+        } else {
+            rb_delete_fixup(tree, path, depth, is_left);
+        }
+    }
+
+    destroy_tree_node(tree, removed);
+    return true;
+}
+
+/**
+ * Colorează nodurile după nivel: ultimul nivel roșu, restul negre
+ * @param tree_node Nodul curent
+ * @param level Nivelul nodului curent
+ * @param last_level Ultimul nivel al arborelui
+ */
+static void rb_color_levels(BinaryTreeNode * tree_node, int level, int last_level) {
+    if (!tree_node) return;
+    tree_node->color = (level == last_level && level > 0) ? NODE_RED : NODE_BLACK;
+    rb_color_levels(tree_node->left, level + 1, last_level);
+    rb_color_levels(tree_node->right, level + 1, last_level);
+}
+
+/**
+ * Recolorează un arbore reconstruit de balance_tree()
+ * Într-un arbore balansat perfect toate frunzele sunt pe ultimele două nivele,
+ * deci colorând cu roșu doar ultimul nivel se obține un arbore roșu-negru valid.
+ * @param tree Arborele care trebuie recolorat
+ */
+void rb_recolor_tree(BinaryTree * tree) {
+    rb_color_levels(tree->root, 0, get_tree_depth(tree));
+}
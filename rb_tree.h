@@ -0,0 +1,20 @@
+/**
+ * Politica de balansare roșu-negru pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_RB_TREE_H
+#define SDA_LAB4_RB_TREE_H
+
+#include <stdbool.h>
+
+#include "binary_tree.h"
+
+/* Înălțimea unui arbore roșu-negru cu n noduri este cel mult 2 * log2(n + 1) */
+#define RB_MAX_HEIGHT 96
+
+void rb_insert_node(BinaryTree * tree, BinaryTreeNode * new_node);
+bool rb_delete(BinaryTree * tree, int key);
+void rb_recolor_tree(BinaryTree * tree);
+
+#endif // SDA_LAB4_RB_TREE_H
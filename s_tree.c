@@ -0,0 +1,263 @@
+/**
+ * Arbore de căutare static cu 16 chei pe nod (S-tree), comparate cu instrucțiuni SIMD
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Cele 16 chei ale unui bloc sunt comparate simultan cu AVX2 (dacă se compilează
+ * cu SDA_ENABLE_AVX2), cu SSE2 (implicit pe x86-64) sau, în lipsa lor, cu o buclă
+ * scalară. Ca și FrozenTree, structura păstrează pointeri la cărțile arborelui și
+ * trebuie reconstruită după modificarea acestuia.
+ */
+
+#include <stdlib.h>
+#include <limits.h>
+
+#include "s_tree.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Dimensiunea unei linii de cache, în octeți */
+#define CACHE_LINE_SIZE 64
+
+/* Valoarea cheilor de umplutură din ultimele blocuri */
+#define S_TREE_PADDING INT_MAX
+
+/* Valoare returnată când nu există nicio cheie mai mare sau egală */
+#define NOT_FOUND_SLOT -1
+
+#if defined(__GNUC__) || defined(__clang__)
+#define S_TREE_PREFETCH(address) __builtin_prefetch(address)
+#define S_TREE_POPCOUNT(mask) __builtin_popcount(mask)
+#else
+#define S_TREE_PREFETCH(address) ((void)0)
+static int S_TREE_POPCOUNT(unsigned mask) {
+    int count = 0;
+    for (; mask; mask &= mask - 1) count++;
+    return count;
+}
+#endif
+
+/**
+ * Returnează indicele copilului i al blocului k
+ * @param block Indicele blocului
+ * @param child Indicele copilului (0..16)
+ * @return Indicele blocului copil
+ */
+static size_t s_tree_child(size_t block, size_t child) {
+    return block * (S_TREE_BLOCK_KEYS + 1) + child + 1;
+}
+
+/**
+ * Numără cheile dintr-un bloc mai mici decât cheia căutată
+ * Cheile blocului sunt sortate, deci rezultatul este poziția primei chei >= key.
+ * @param block Cele 16 chei ale blocului (aliniate la 64 de octeți)
+ * @param key Cheia căutată
+ * @return Poziția primei chei >= key (16 dacă nu există)
+ */
+static int s_tree_block_rank(const int * block, int key) {
+#if defined(__AVX2__)
+    __m256i needle = _mm256_set1_epi32(key);
+    __m256i low = _mm256_cmpgt_epi32(needle, _mm256_load_si256((const __m256i *)block));
+    __m256i high = _mm256_cmpgt_epi32(needle, _mm256_load_si256((const __m256i *)(block + 8)));
+    unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(low)) |
+                    ((unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(high)) << 8);
+    return S_TREE_POPCOUNT(mask);
+#elif defined(__SSE2__)
+    __m128i needle = _mm_set1_epi32(key);
+    unsigned mask = 0;
+    for (int part = 0; part < 4; part++) {
+        __m128i less = _mm_cmpgt_epi32(needle, _mm_load_si128((const __m128i *)(block + 4 * part)));
+        mask |= (unsigned)_mm_movemask_ps(_mm_castsi128_ps(less)) << (4 * part);
+    }
+    return S_TREE_POPCOUNT(mask);
+#else
+    int rank = 0;
+    for (int i = 0; i < S_TREE_BLOCK_KEYS; i++) rank += block[i] < key;
+    return rank;
+#endif
+}
+
+/**
+ * Returnează numele variantei SIMD cu care a fost compilată căutarea
+ * @return "AVX2", "SSE2" sau "scalar"
+ */
+const char * s_tree_simd_name(void) {
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE2__)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+/**
+ * Completează blocurile printr-o parcurgere în inordine a pozițiilor
+ * @param s_tree Arborele construit
+ * @param sorted_keys Cheile în ordine crescătoare
+ * @param next Indicele următoarei chei sortate
+ * @param block Blocul curent
+ * @return Indicele următoarei chei sortate după completarea subarborelui
+ */
+static size_t s_tree_fill(STree * s_tree, int * sorted_keys, size_t next, size_t block) {
+    if (block >= s_tree->block_count) return next;
+
+    for (size_t i = 0; i < S_TREE_BLOCK_KEYS; i++) {
+        next = s_tree_fill(s_tree, sorted_keys, next, s_tree_child(block, i));
+
+        size_t slot = block * S_TREE_BLOCK_KEYS + i;
+        if (next < s_tree->size) {
+            s_tree->keys[slot] = sorted_keys[next];
+            s_tree->book_index[slot] = (int)next;
+            next++;
+        } else {
+            // Pozițiile rămase după ultima cheie sunt umplute cu valoarea maximă
+            s_tree->keys[slot] = S_TREE_PADDING;
+            s_tree->book_index[slot] = (int)s_tree->size;
+        }
+    }
+    return s_tree_fill(s_tree, sorted_keys, next, s_tree_child(block, S_TREE_BLOCK_KEYS));
+}
+
+/**
+ * Construiește arborele static din lista nodurilor în inordine (aceeași listă ca la freeze_tree)
+ * Complexitate: O(n)
+ * @param tree Arborele sursă
+ * @return Arborele static construit
+ */
+STree * build_s_tree(BinaryTree * tree) {
+    List * nodes = get_tree_nodes_list(tree);
+
+    size_t size = 0;
+    for (ListNode * head = nodes->head; head; head = head->next) size++;
+
+    STree * s_tree = (STree *)malloc(sizeof(STree));
+    s_tree->size = size;
+    s_tree->block_count = (size + S_TREE_BLOCK_KEYS - 1) / S_TREE_BLOCK_KEYS;
+
+    // Un bloc are exact 64 de octeți, deci dimensiunea este multiplu al alinierii
+    size_t slots = (s_tree->block_count ? s_tree->block_count : 1) * S_TREE_BLOCK_KEYS;
+    s_tree->keys = (int *)aligned_alloc(CACHE_LINE_SIZE, slots * sizeof(int));
+    s_tree->book_index = (int *)malloc(slots * sizeof(int));
+    s_tree->books = (Book **)malloc((size ? size : 1) * sizeof(Book *));
+
+    int * sorted_keys = (int *)malloc((size ? size : 1) * sizeof(int));
+    size_t i = 0;
+    for (ListNode * head = nodes->head; head; head = head->next, i++) {
+        sorted_keys[i] = head->tree_node->key;
+        s_tree->books[i] = head->tree_node->book;
+    }
+    free_list(nodes);
+
+    s_tree_fill(s_tree, sorted_keys, 0, 0);
+    free(sorted_keys);
+
+    return s_tree;
+}
+
+/**
+ * Găsește poziția (în tabloul de blocuri) a primei chei mai mari sau egale cu cheia dată
+ * Complexitate: O(log17 n) blocuri, fiecare comparat dintr-o singură operație vectorială
+ * @param s_tree Arborele static
+ * @param key Cheia căutată
+ * @return Poziția cheii găsite sau NOT_FOUND_SLOT dacă nu există o astfel de cheie
+ */
+static long s_tree_find_slot(STree * s_tree, int key) {
+    long slot = NOT_FOUND_SLOT;
+    size_t block = 0;
+
+    while (block < s_tree->block_count) {
+        int rank = s_tree_block_rank(s_tree->keys + block * S_TREE_BLOCK_KEYS, key);
+
+        // Candidatul găsit mai jos precede mereu în ordine candidatul de mai sus
+        if (rank < S_TREE_BLOCK_KEYS) slot = (long)(block * S_TREE_BLOCK_KEYS) + rank;
+        block = s_tree_child(block, (size_t)rank);
+    }
+
+    return slot;
+}
+
+/**
+ * Găsește prima cheie mai mare sau egală cu cheia dată
+ * @param s_tree Arborele static
+ * @param key Cheia căutată
+ * @return Indicele cărții în s_tree->books sau s_tree->size dacă nu există
+ */
+long s_tree_lower_bound(STree * s_tree, int key) {
+    long slot = s_tree_find_slot(s_tree, key);
+    return slot == NOT_FOUND_SLOT ? (long)s_tree->size : s_tree->book_index[slot];
+}
+
+/**
+ * Caută o carte după cheie
+ * Egalitatea se verifică pe cheia din bloc, deci cartea este citită doar dacă există
+ * @param s_tree Arborele static
+ * @param key Cheia căutată
+ * @return Cartea găsită sau NULL dacă nu există
+ */
+Book * s_tree_get(STree * s_tree, int key) {
+    long slot = s_tree_find_slot(s_tree, key);
+    if (slot == NOT_FOUND_SLOT || s_tree->keys[slot] != key) return NULL;
+
+    long index = s_tree->book_index[slot];
+    return index < (long)s_tree->size ? s_tree->books[index] : NULL;
+}
+
+/**
+ * Caută mai multe chei simultan: cererile unui grup coboară nivel cu nivel împreună,
+ * iar blocul următor al fiecărei cereri este preîncărcat înainte de a fi comparat,
+ * astfel încât așteptările după memorie ale cererilor se suprapun.
+ * @param s_tree Arborele static
+ * @param keys Cheile căutate
+ * @param count Numărul de chei
+ * @param results Pentru fiecare cheie, rezultatul lui s_tree_lower_bound()
+ */
+void s_tree_lower_bound_batch(STree * s_tree, const int * keys, size_t count, long * results) {
+    size_t blocks[S_TREE_BATCH_SIZE];
+
+    for (size_t start = 0; start < count; start += S_TREE_BATCH_SIZE) {
+        size_t group = count - start < S_TREE_BATCH_SIZE ? count - start : S_TREE_BATCH_SIZE;
+
+        for (size_t j = 0; j < group; j++) {
+            blocks[j] = 0;
+            results[start + j] = (long)s_tree->size;
+        }
+
+        // Toate cererile coboară pe același număr de nivele, cu excepția ultimului nivel incomplet
+        bool active = s_tree->block_count > 0;
+        while (active) {
+            active = false;
+            for (size_t j = 0; j < group; j++) {
+                size_t block = blocks[j];
+                if (block >= s_tree->block_count) continue;
+
+                int rank = s_tree_block_rank(s_tree->keys + block * S_TREE_BLOCK_KEYS, keys[start + j]);
+                if (rank < S_TREE_BLOCK_KEYS) {
+                    results[start + j] = s_tree->book_index[block * S_TREE_BLOCK_KEYS + rank];
+                }
+
+                block = s_tree_child(block, (size_t)rank);
+                blocks[j] = block;
+                if (block < s_tree->block_count) {
+                    S_TREE_PREFETCH(s_tree->keys + block * S_TREE_BLOCK_KEYS);
+                    active = true;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Eliberează arborele static (cărțile rămân în arborele sursă)
+ * @param s_tree Arborele static
+ */
+void free_s_tree(STree * s_tree) {
+    if (!s_tree) return;
+    free(s_tree->keys);
+    free(s_tree->book_index);
+    free(s_tree->books);
+    free(s_tree);
+}
@@ -0,0 +1,41 @@
+/**
+ * Arbore de căutare static cu 16 chei pe nod (S-tree), comparate cu instrucțiuni SIMD
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_S_TREE_H
+#define SDA_LAB4_S_TREE_H
+
+#include <stddef.h>
+
+#include "binary_tree.h"
+
+/* Numărul de chei dintr-un bloc: 16 chei int ocupă exact o linie de cache */
+#define S_TREE_BLOCK_KEYS 16
+
+/* Numărul de cereri căutate simultan de s_tree_lower_bound_batch() */
+#define S_TREE_BATCH_SIZE 16
+
+/**
+ * Structură pentru arborele static
+ * Blocul k are copiii k * 17 + 1 ... k * 17 + 17; fiecare bloc conține 16 chei
+ * sortate, iar cheile subarborelui copilului i se află între cheile i - 1 și i
+ * ale blocului. O căutare citește o singură linie de cache pe nivel, iar
+ * numărul de nivele este log17(n) în loc de log2(n).
+ */
+typedef struct STree {
+    int * keys;                        // Blocurile de chei (aliniate la 64 de octeți)
+    int * book_index;                  // Pentru fiecare cheie, indicele cărții în books
+    Book ** books;                     // Cărțile în ordinea crescătoare a cheilor
+    size_t size;                       // Numărul de chei
+    size_t block_count;                // Numărul de blocuri
+} STree;
+
+STree * build_s_tree(BinaryTree * tree);
+long s_tree_lower_bound(STree * s_tree, int key);
+Book * s_tree_get(STree * s_tree, int key);
+void s_tree_lower_bound_batch(STree * s_tree, const int * keys, size_t count, long * results);
+const char * s_tree_simd_name(void);
+void free_s_tree(STree * s_tree);
+
+#endif // SDA_LAB4_S_TREE_H
@@ -0,0 +1,93 @@
+/**
+ * Politica de balansare scapegoat pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Nodurile nu păstrează nicio informație de balansare. Când o inserare ajunge
+ * mai adânc decât log_{1/alfa}(n), urcăm spre rădăcină până la primul strămoș
+ * dezechilibrat (țapul ispășitor) și reconstruim doar subarborele lui cu
+ * rebuild_subtree(). Actualizările costă O(log n) amortizat, fără pauzele
+ * unei reconstruiri complete a arborelui.
+ */
+
+#include <math.h>
+
+#include "scapegoat_tree.h"
+
+/**
+ * Numără nodurile unui subarbore
+ * Subarborii unui arbore scapegoat au adâncimea O(log n), deci recursivitatea este scurtă.
+ * @param tree_node Rădăcina subarborelui
+ * @return Numărul de noduri
+ */
+static size_t scapegoat_count_nodes(BinaryTreeNode * tree_node) {
+    if (!tree_node) return 0;
+    return 1 + scapegoat_count_nodes(tree_node->left) + scapegoat_count_nodes(tree_node->right);
+}
+
+/**
+ * Verifică dacă un nod aflat la adâncimea dată depășește limita log_{1/alfa}(n)
+ * @param depth Adâncimea nodului (rădăcina are adâncimea 0)
+ * @param node_count Numărul de noduri din arbore
+ * @return true dacă nodul este prea adânc
+ */
+static bool scapegoat_too_deep(int depth, size_t node_count) {
+    return depth > log((double)node_count) / -log(SCAPEGOAT_ALPHA);
+}
+
+/**
+ * Inserează un nod nou în arborele scapegoat
+ * Dacă nodul ajunge prea adânc, reconstruiește subarborele primului strămoș
+ * în care un copil are mai mult de alfa din noduri. Cheile egale sunt trimise
+ * la dreapta, la fel ca în insert() pentru arborele simplu.
+ * Complexitate: O(log n) amortizat
+ * @param tree Arborele în care se inserează (node_count include deja nodul nou)
+ * @param new_node Nodul care va fi inserat
+ */
+void scapegoat_insert_node(BinaryTree * tree, BinaryTreeNode * new_node) {
+    // Drumul se memorează ca adrese ale legăturilor, ca reconstruirea să poată înlocui subarborele
+    BinaryTreeNode ** path[SCAPEGOAT_MAX_HEIGHT];
+    int depth = 0;
+    int key = new_node->key;
+
+    BinaryTreeNode ** link = &tree->root;
+    while (*link) {
+        path[depth++] = link;
+        link = ((*link)->key > key) ? &(*link)->left : &(*link)->right;
+    }
+    *link = new_node;
+
+    if (tree->node_count > tree->max_node_count) tree->max_node_count = tree->node_count;
+
+    if (!scapegoat_too_deep(depth, tree->node_count)) return;
+
+    // Urcăm spre rădăcină, numărând nodurile, până la primul strămoș dezechilibrat
+    BinaryTreeNode * child = new_node;
+    size_t child_size = 1;
+    while (depth > 0) {
+        BinaryTreeNode ** parent_link = path[--depth];
+        BinaryTreeNode * parent = *parent_link;
+        BinaryTreeNode * sibling = (parent->left == child) ? parent->right : parent->left;
+        size_t parent_size = child_size + scapegoat_count_nodes(sibling) + 1;
+
+        if ((double)child_size > SCAPEGOAT_ALPHA * (double)parent_size) {
+            *parent_link = rebuild_subtree(parent);
+            return;
+        }
+
+        child = parent;
+        child_size = parent_size;
+    }
+}
+
+/**
+ * Reconstruiește tot arborele după o ștergere dacă a pierdut prea multe noduri
+ * Limita de adâncime depinde de numărul de noduri, așa că după multe ștergeri
+ * arborele este refăcut o dată, când scade sub alfa din dimensiunea maximă.
+ * @param tree Arborele din care tocmai s-a șters un nod
+ */
+void scapegoat_after_delete(BinaryTree * tree) {
+    if ((double)tree->node_count >= SCAPEGOAT_ALPHA * (double)tree->max_node_count) return;
+
+    tree->root = rebuild_subtree(tree->root);
+    tree->max_node_count = tree->node_count;
+}
@@ -0,0 +1,20 @@
+/**
+ * Politica de balansare scapegoat pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_SCAPEGOAT_TREE_H
+#define SDA_LAB4_SCAPEGOAT_TREE_H
+
+#include "binary_tree.h"
+
+/* Un subarbore este dezechilibrat dacă un copil are mai mult de alfa din nodurile lui */
+#define SCAPEGOAT_ALPHA 0.7
+
+/* Adâncimea maximă permisă este log_{1/alfa}(n), sub 128 pentru orice număr de noduri încăput în memorie */
+#define SCAPEGOAT_MAX_HEIGHT 128
+
+void scapegoat_insert_node(BinaryTree * tree, BinaryTreeNode * new_node);
+void scapegoat_after_delete(BinaryTree * tree);
+
+#endif // SDA_LAB4_SCAPEGOAT_TREE_H
@@ -0,0 +1,386 @@
+/**
+ * Arbore împărțit pe intervale de chei în mai mulți arbori independenți
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Fiecare partiție este un ConcurrentTree cu propriul zăvor și propriile blocuri
+ * de memorie, așa că operațiile pe chei din partiții diferite nu împart nimic.
+ * O cheie este trimisă partiției ei prin căutare binară în limitele dintre
+ * partiții. Limitele pot fi mutate de sharded_rebalance() în timp ce alte fire
+ * lucrează, de aceea, după ce ia zăvorul partiției, un fir verifică intervalul
+ * partiției (protejat de același zăvor) și reîncearcă dacă cheia nu mai este acolo.
+ *
+ * Partițiile sunt ordonate după interval, deci o interogare pe interval sau o
+ * parcurgere în inordine vizitează partițiile pe rând, fără interclasare.
+ * Mai multe partiții sunt blocate mereu în ordine crescătoare, deci fără interblocări.
+ */
+
+#include <stdlib.h>
+#include <limits.h>
+#include <sched.h>
+
+#include "sharded_tree.h"
+#include "tree_iterator.h"
+
+static int compare_ints(const void * a, const void * b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Scrie limitele partițiilor după cele shard_count - 1 puncte de separare
+ */
+static void apply_split_points(ShardedTree * sharded, const int * split_points) {
+    for (int i = 0; i < sharded->shard_count - 1; i++) atomic_store(&sharded->split_points[i], split_points[i]);
+    for (int i = 0; i < sharded->shard_count; i++) {
+        sharded->shards[i].lower = i == 0 ? INT_MIN : split_points[i - 1];
+        sharded->shards[i].upper = i == sharded->shard_count - 1 ? (long long)INT_MAX + 1 : split_points[i];
+    }
+}
+
+/**
+ * Creează un arbore împărțit în shard_count partiții
+ * Limitele sunt alese din eșantion, astfel încât fiecare partiție să primească
+ * aproximativ aceeași parte din chei; fără eșantion, intervalul int este împărțit egal.
+ * @param mode Politica de balansare a fiecărei partiții
+ * @param shard_count Numărul de partiții (cel puțin 1)
+ * @param sample Chei reprezentative pentru cele care vor fi inserate (poate fi NULL)
+ * @param sample_size Numărul de chei din eșantion
+ * @return Pointer la noul arbore
+ */
+ShardedTree * create_sharded_tree(TreeBalanceMode mode, int shard_count, const int * sample, size_t sample_size) {
+    if (shard_count < 1) shard_count = 1;
+
+    ShardedTree * sharded = (ShardedTree *)malloc(sizeof(ShardedTree));
+    sharded->shard_count = shard_count;
+    sharded->shards = (TreeShard *)malloc(shard_count * sizeof(TreeShard));
+    sharded->split_points = (_Atomic int *)malloc((shard_count > 1 ? shard_count - 1 : 1) * sizeof(_Atomic int));
+    for (int i = 0; i < shard_count; i++) sharded->shards[i].concurrent = create_concurrent_tree(mode);
+
+    int * split_points = (int *)malloc((shard_count > 1 ? shard_count - 1 : 1) * sizeof(int));
+    if (sample && sample_size > 0) {
+        // Cuantilele eșantionului
+        int * sorted = (int *)malloc(sample_size * sizeof(int));
+        for (size_t i = 0; i < sample_size; i++) sorted[i] = sample[i];
+        qsort(sorted, sample_size, sizeof(int), compare_ints);
+        for (int i = 0; i < shard_count - 1; i++) split_points[i] = sorted[(size_t)(i + 1) * sample_size / shard_count];
+        free(sorted);
+    } else {
+        long long span = (long long)INT_MAX - INT_MIN + 1;
+        for (int i = 0; i < shard_count - 1; i++) split_points[i] = (int)(INT_MIN + span * (i + 1) / shard_count);
+    }
+
+    for (int i = 0; i < shard_count - 1; i++) atomic_init(&sharded->split_points[i], 0);
+    apply_split_points(sharded, split_points);
+    free(split_points);
+    return sharded;
+}
+
+/**
+ * Eliberează arborele și toate partițiile; niciun alt fir nu trebuie să îl mai folosească
+ * @param sharded Arborele (poate fi NULL)
+ */
+void free_sharded_tree(ShardedTree * sharded) {
+    if (!sharded) return;
+    for (int i = 0; i < sharded->shard_count; i++) free_concurrent_tree(sharded->shards[i].concurrent);
+    free(sharded->shards);
+    free(sharded->split_points);
+    free(sharded);
+}
+
+/**
+ * Găsește partiția unei chei după limitele curente (numărul de limite mai mici sau egale cu cheia)
+ */
+static int route(ShardedTree * sharded, int key) {
+    int low = 0, high = sharded->shard_count - 1;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (atomic_load_explicit(&sharded->split_points[middle], memory_order_relaxed) <= key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static void lock_shard(TreeShard * shard, bool write) {
+    if (write) pthread_rwlock_wrlock(&shard->concurrent->lock);
+    else pthread_rwlock_rdlock(&shard->concurrent->lock);
+}
+
+static void unlock_shard(TreeShard * shard) {
+    pthread_rwlock_unlock(&shard->concurrent->lock);
+}
+
+/**
+ * Blochează partiția care conține cheia
+ * Dacă limitele s-au mutat între căutare și blocare, încercăm din nou.
+ * @return Partiția blocată
+ */
+static TreeShard * lock_shard_for(ShardedTree * sharded, int key, bool write) {
+    while (true) {
+        TreeShard * shard = &sharded->shards[route(sharded, key)];
+        lock_shard(shard, write);
+        if (key >= shard->lower && key < shard->upper) return shard;
+        unlock_shard(shard);
+    }
+}
+
+/**
+ * Creează și inserează o carte în partiția cheii ei
+ */
+void sharded_insert(ShardedTree * sharded, int key, char * title, char * author,
+                    int pub_year, int page_count, int quantity_sold) {
+    TreeShard * shard = lock_shard_for(sharded, key, true);
+    BinaryTree * tree = shard->concurrent->tree;
+    insert(tree, create_book(tree, key, title, author, pub_year, page_count, quantity_sold));
+    unlock_shard(shard);
+}
+
+/**
+ * Caută o carte și o copiază în out (ca concurrent_get())
+ * Numele autorilor nu sunt eliberate de partiții, deci numele returnat este valid
+ * până la free_sharded_tree(), chiar dacă între timp cartea este mutată sau ștearsă.
+ * @param sharded Arborele
+ * @param key Cheia căutată
+ * @param out Primește cartea găsită, fără legăturile indexului după autor (poate fi NULL)
+ * @param title Buffer de MAX_TITLE_LENGTH caractere pentru titlu (poate fi NULL)
+ * @param author Primește numele autorului (poate fi NULL)
+ * @return true dacă cartea a fost găsită, false altfel
+ */
+bool sharded_get(ShardedTree * sharded, int key, Book * out, char * title, const char ** author) {
+    TreeShard * shard = lock_shard_for(sharded, key, false);
+    BinaryTree * tree = shard->concurrent->tree;
+    BinaryTreeNode * tree_node = get(tree, key);
+    if (tree_node && out) snapshot_book(tree_node->book, out, title);
+    if (tree_node && author) *author = get_book_author(tree, tree_node->book);
+    unlock_shard(shard);
+    return tree_node != NULL;
+}
+
+/**
+ * Șterge cartea cu cheia dată din partiția ei
+ * @return true dacă cartea a fost găsită și ștearsă, false altfel
+ */
+bool sharded_delete(ShardedTree * sharded, int key) {
+    TreeShard * shard = lock_shard_for(sharded, key, true);
+    bool deleted = delete_key(shard->concurrent->tree, key);
+    unlock_shard(shard);
+    return deleted;
+}
+
+/**
+ * Vizitează crescător nodurile cu cheile în [lo, hi], din toate partițiile atinse
+ * Partițiile atinse sunt blocate pentru citire toate deodată (în ordine, deci fără
+ * interblocări), așa că rezultatul este consistent chiar dacă limitele se mută.
+ * Stiva este a firului apelant (ca la concurrent_range_query_with()), deci
+ * interogarea nu face alocări.
+ * @param stack Stiva firului; este golită aici
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool sharded_range_query_with(ShardedTree * sharded, int lo, int hi, TreeVisitor visitor, void * context, Stack * stack) {
+    if (lo > hi) return true;
+
+    int first, last;
+    while (true) {
+        first = route(sharded, lo);
+        last = route(sharded, hi);
+        if (first <= last) {
+            for (int i = first; i <= last; i++) lock_shard(&sharded->shards[i], false);
+            // Intervalele partițiilor sunt mereu alăturate, deci ajunge să verificăm capetele
+            if (sharded->shards[first].lower <= lo && sharded->shards[last].upper > hi) break;
+            for (int i = first; i <= last; i++) unlock_shard(&sharded->shards[i]);
+        }
+        sched_yield();  // O limită este mutată chiar acum: lăsăm rebalansarea să termine
+    }
+
+    bool finished = true;
+    for (int i = first; i <= last && finished; i++) {
+        stack_clear(stack);
+        finished = range_query_with(sharded->shards[i].concurrent->tree, lo, hi, visitor, context, stack);
+    }
+
+    for (int i = first; i <= last; i++) unlock_shard(&sharded->shards[i]);
+    return finished;
+}
+
+/**
+ * Parcurge toate cărțile în ordinea crescătoare a cheilor, partiție după partiție
+ * @param stack Stiva firului
+ * @return true dacă parcurgerea s-a terminat, false dacă vizitatorul a oprit-o
+ */
+bool sharded_traverse_with(ShardedTree * sharded, TreeVisitor visitor, void * context, Stack * stack) {
+    return sharded_range_query_with(sharded, INT_MIN, INT_MAX, visitor, context, stack);
+}
+
+/**
+ * Returnează numărul total de cărți (fiecare partiție este citită sub zăvorul ei)
+ */
+size_t sharded_node_count(ShardedTree * sharded) {
+    size_t count = 0;
+    for (int i = 0; i < sharded->shard_count; i++) {
+        lock_shard(&sharded->shards[i], false);
+        count += sharded->shards[i].concurrent->tree->node_count;
+        unlock_shard(&sharded->shards[i]);
+    }
+    return count;
+}
+
+typedef struct BookCollector {
+    Book ** books;
+    size_t count;
+} BookCollector;
+
+static bool collect_book(BinaryTreeNode * tree_node, void * context) {
+    BookCollector * collector = (BookCollector *)context;
+    collector->books[collector->count++] = tree_node->book;
+    return true;
+}
+
+/**
+ * Copiază cărțile sortate în arborele destinație începând cu mijlocul,
+ * ca și o partiție nebalansată să rămână echilibrată
+ */
+static void insert_from_middle(BinaryTree * destination, BinaryTree * source, Book ** books, size_t from, size_t to) {
+    if (from >= to) return;
+
+    size_t middle = from + (to - from) / 2;
+    Book * book = books[middle];
+    insert(destination, create_book(destination, book->key, (char *)book->title,
+                                    (char *)get_book_author(source, book),
+                                    book->pub_year, book->page_count, book->quantity_sold));
+    insert_from_middle(destination, source, books, from, middle);
+    insert_from_middle(destination, source, books, middle + 1, to);
+}
+
+/**
+ * Mută cărțile cu cheile în [lo, hi] dintr-o partiție în alta (ambele blocate pentru scriere)
+ * Cărțile sunt copiate în destinație și apoi șterse din sursă. Ștergerea eliberează
+ * locul titlului în depozitul sursei, pentru cărțile inserate sau mutate mai târziu;
+ * autorul rămâne internat în sursă, o singură dată, oricâte cărți ale lui trec prin ea.
+ */
+static void move_books(BinaryTree * source, BinaryTree * destination, int lo, int hi) {
+    size_t count = range_count(source, lo, hi);
+    if (count == 0) return;
+
+    BookCollector collector = { (Book **)malloc(count * sizeof(Book *)), 0 };
+    range_query(source, lo, hi, collect_book, &collector);
+    insert_from_middle(destination, source, collector.books, 0, count);
+
+    // Cheile sunt salvate înainte: cu chei egale, o ștergere poate elibera altă carte decât cea din tablou
+    int * keys = (int *)malloc(count * sizeof(int));
+    for (size_t i = 0; i < count; i++) keys[i] = collector.books[i]->key;
+    for (size_t i = 0; i < count; i++) delete_key(source, keys[i]);
+
+    free(keys);
+    free(collector.books);
+}
+
+/**
+ * Returnează cheia de pe poziția position (numărată de la 0) a unui arbore
+ * Iteratorul pornește de la capătul mai apropiat și face cel mult câți pași
+ * sunt cărți de mutat, deci partițiile nu au nevoie de dimensiunile subarborilor
+ * (care ar rămâne pornite și ar încetini fiecare inserare).
+ * @param tree Arborele (cu cel puțin position + 1 noduri)
+ * @param position Poziția în ordinea crescătoare a cheilor
+ * @return Cheia de pe poziția dată
+ */
+static int key_at(BinaryTree * tree, size_t position) {
+    TreeIterator * iterator = create_tree_iterator(tree);
+    BinaryTreeNode * node;
+    if (position < tree->node_count / 2) {
+        node = tree_iterator_first(iterator);
+        for (size_t i = 0; i < position; i++) node = tree_iterator_next(iterator);
+    } else {
+        node = tree_iterator_last(iterator);
+        for (size_t i = tree->node_count - 1; i > position; i--) node = tree_iterator_prev(iterator);
+    }
+    int key = node->key;
+    free_tree_iterator(iterator);
+    return key;
+}
+
+/**
+ * Mută limita dintre partițiile index și index + 1 (ambele blocate pentru scriere)
+ */
+static void move_split_point(ShardedTree * sharded, int index, int split_point) {
+    atomic_store(&sharded->split_points[index], split_point);
+    sharded->shards[index].upper = split_point;
+    sharded->shards[index + 1].lower = split_point;
+}
+
+/**
+ * Mută limita dintre partițiile index și index + 1 astfel încât partițiile 0..index
+ * să aibă împreună aproximativ total * (index + 1) / shard_count cărți
+ * Sunt blocate pentru scriere doar cele două partiții vecine. Spre dreapta se mută
+ * doar surplusul partiției din stânga, spre stânga doar lipsa ei.
+ * @param sharded Arborele
+ * @param index Limita mutată
+ * @param total Numărul total de cărți
+ * @param outside Cărțile din partițiile de dinainte (spre dreapta) sau de după (spre stânga) cele două
+ * @param to_right Direcția în care se pot muta cărțile
+ * @return Numărul de cărți rămase în partiția stângă (spre dreapta) sau dreaptă (spre stânga)
+ */
+static size_t rebalance_split_point(ShardedTree * sharded, int index, size_t total, size_t outside, bool to_right) {
+    TreeShard * left = &sharded->shards[index];
+    TreeShard * right = &sharded->shards[index + 1];
+    lock_shard(left, true);
+    lock_shard(right, true);
+
+    BinaryTree * left_tree = left->concurrent->tree;
+    BinaryTree * right_tree = right->concurrent->tree;
+    size_t target = total * (index + 1) / sharded->shard_count;
+    size_t through_left;
+    if (to_right) {
+        through_left = outside + left_tree->node_count;
+    } else {
+        size_t after_left = outside + right_tree->node_count;
+        through_left = total > after_left ? total - after_left : 0;
+    }
+
+    if (to_right && through_left > target && left_tree->node_count > 0) {
+        // Cele mai mari chei din stânga trec în dreapta, cu tot cu cheile egale cu noua limită
+        size_t excess = through_left - target;
+        if (excess > left_tree->node_count) excess = left_tree->node_count;
+        int split_point = key_at(left_tree, left_tree->node_count - excess);
+        move_books(left_tree, right_tree, split_point, INT_MAX);
+        move_split_point(sharded, index, split_point);
+    } else if (!to_right && through_left < target && right_tree->node_count > 1) {
+        // Cele mai mici chei din dreapta trec în stânga; cel puțin o cheie rămâne și dă noua limită
+        size_t missing = target - through_left;
+        if (missing > right_tree->node_count - 1) missing = right_tree->node_count - 1;
+        int split_point = key_at(right_tree, missing);
+        if (split_point > right->lower) {
+            move_books(right_tree, left_tree, INT_MIN, split_point - 1);
+            move_split_point(sharded, index, split_point);
+        }
+    }
+
+    size_t kept = to_right ? left_tree->node_count : right_tree->node_count;
+    unlock_shard(right);
+    unlock_shard(left);
+    return kept;
+}
+
+/**
+ * Mută limitele dintre partiții astfel încât fiecare să aibă aproximativ același număr de cărți
+ * Limitele sunt mutate pe rând, cu rebalance_split_point(), deci la un moment dat
+ * sunt blocate doar două partiții vecine; celelalte rămân disponibile. Surplusul
+ * este împins spre dreapta de la stânga la dreapta, apoi lipsurile sunt acoperite
+ * de la dreapta la stânga, astfel încât cărțile pot traversa mai multe partiții.
+ * Numărul total este citit la început, deci inserările făcute între timp sunt
+ * împărțite abia la următoarea rebalansare.
+ * Complexitate: O(m log n) pentru m cărți mutate; limitele noi sunt găsite cu un
+ * iterator, în O(m + log n), fără dimensiunile subarborilor
+ * @param sharded Arborele
+ */
+void sharded_rebalance(ShardedTree * sharded) {
+    int count = sharded->shard_count;
+    size_t total = sharded_node_count(sharded);
+
+    size_t outside = 0;  // Cărțile din partițiile deja trecute
+    for (int i = 0; i < count - 1; i++) outside += rebalance_split_point(sharded, i, total, outside, true);
+
+    outside = 0;
+    for (int i = count - 2; i >= 0; i--) outside += rebalance_split_point(sharded, i, total, outside, false);
+}
@@ -0,0 +1,59 @@
+/**
+ * Arbore împărțit pe intervale de chei în mai mulți arbori independenți
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_SHARDED_TREE_H
+#define SDA_LAB4_SHARDED_TREE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "binary_tree.h"
+#include "concurrent_tree.h"
+
+/**
+ * O partiție: un arbore cu zăvorul și blocurile lui de memorie, plus intervalul de chei
+ * Intervalul [lower, upper) se schimbă doar când sharded_rebalance() mută o limită a
+ * partiției, cu partiția și vecina de la acea limită blocate pentru scriere, deci
+ * poate fi citit oricând cu zăvorul partiției luat.
+ */
+typedef struct TreeShard {
+    ConcurrentTree * concurrent;       // Arborele partiției și zăvorul lui
+    long long lower;                   // Cea mai mică cheie a partiției (inclusă)
+    long long upper;                   // Prima cheie după partiție (exclusă)
+} TreeShard;
+
+/**
+ * Structură pentru arborele împărțit
+ * Partiția i conține cheile din [split_points[i - 1], split_points[i]), deci
+ * parcurgerea partițiilor în ordine dă cheile în ordine crescătoare.
+ * sharded_rebalance() mută câte o limită odată, blocând doar cele două partiții
+ * vecine. O carte mutată este copiată în partiția nouă și ștearsă din cea veche,
+ * care refolosește locul titlului. sharded_get() copiază deci titlul în bufferul
+ * apelantului; numele autorilor rămân internate în partiții până la free_sharded_tree().
+ * Memoria șirurilor nu crește cu numărul de rebalansări: titlurile ocupă cel mult
+ * cât cărțile prezente în fiecare partiție (plus locurile libere refolosite), iar
+ * fiecare partiție internează un autor o singură dată, deci cel mult
+ * shard_count * (autori distincți) nume.
+ */
+typedef struct ShardedTree {
+    TreeShard * shards;                // Partițiile, în ordinea intervalelor
+    _Atomic int * split_points;        // Cele shard_count - 1 limite dintre partiții
+    int shard_count;                   // Numărul de partiții
+} ShardedTree;
+
+ShardedTree * create_sharded_tree(TreeBalanceMode mode, int shard_count, const int * sample, size_t sample_size);
+void free_sharded_tree(ShardedTree * sharded);
+
+void sharded_insert(ShardedTree * sharded, int key, char * title, char * author,
+                    int pub_year, int page_count, int quantity_sold);
+bool sharded_get(ShardedTree * sharded, int key, Book * out, char * title, const char ** author);
+bool sharded_delete(ShardedTree * sharded, int key);
+bool sharded_range_query_with(ShardedTree * sharded, int lo, int hi, TreeVisitor visitor, void * context, Stack * stack);
+bool sharded_traverse_with(ShardedTree * sharded, TreeVisitor visitor, void * context, Stack * stack);
+size_t sharded_node_count(ShardedTree * sharded);
+void sharded_rebalance(ShardedTree * sharded);
+
+#endif // SDA_LAB4_SHARDED_TREE_H
@@ -0,0 +1,115 @@
+/**
+ * Alocator de tip slab pentru obiecte de dimensiune fixă (noduri și cărți)
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * În loc de câte un malloc pentru fiecare nod și carte, obiectele sunt luate
+ * din blocuri mari. Eliberarea întregului arbore înseamnă eliberarea blocurilor,
+ * adică O(numărul de blocuri) în loc de O(n) apeluri free().
+ */
+
+#include <stdlib.h>
+
+#include "slab_allocator.h"
+
+/* Alinierea obiectelor din bloc */
+#define SLAB_ALIGNMENT 16
+
+/**
+ * Rotunjește o dimensiune la multiplul următor al alinierii
+ * @param size Dimensiunea
+ * @return Dimensiunea aliniată
+ */
+static size_t slab_align(size_t size) {
+    return (size + SLAB_ALIGNMENT - 1) & ~(size_t)(SLAB_ALIGNMENT - 1);
+}
+
+/**
+ * Inițializează un alocator gol; primul bloc se alocă la prima cerere
+ * @param slab Alocatorul
+ * @param object_size Dimensiunea obiectelor alocate
+ */
+void slab_init(SlabAllocator * slab, size_t object_size) {
+    // Un obiect eliberat trebuie să poată păstra pointerul spre următorul obiect liber
+    if (object_size < sizeof(void *)) object_size = sizeof(void *);
+
+    slab->object_size = slab_align(object_size);
+    slab->chunks = NULL;
+    slab->cursor = NULL;
+    slab->limit = NULL;
+    slab->free_list = NULL;
+    slab->next_chunk_objects = SLAB_FIRST_CHUNK_OBJECTS;
+    slab->live_objects = 0;
+    slab->reserved_bytes = 0;
+}
+
+/**
+ * Alocă un bloc nou și îl face bloc curent
+ * @param slab Alocatorul
+ */
+static void slab_grow(SlabAllocator * slab) {
+    size_t capacity = slab->next_chunk_objects;
+    size_t header_size = slab_align(sizeof(SlabChunk));
+    size_t bytes = header_size + capacity * slab->object_size;
+
+    SlabChunk * chunk = (SlabChunk *)malloc(bytes);
+    chunk->next = slab->chunks;
+    chunk->capacity = capacity;
+    slab->chunks = chunk;
+
+    slab->cursor = (char *)chunk + header_size;
+    slab->limit = slab->cursor + capacity * slab->object_size;
+    slab->reserved_bytes += bytes;
+
+    // Blocurile cresc geometric, ca încărcările mari să facă puține apeluri malloc
+    if (slab->next_chunk_objects < SLAB_MAX_CHUNK_OBJECTS) slab->next_chunk_objects *= 2;
+}
+
+/**
+ * Alocă un obiect; refolosește întâi obiectele eliberate
+ * Complexitate: O(1) amortizat
+ * @param slab Alocatorul
+ * @return Pointer la obiectul alocat (neinițializat)
+ */
+void * slab_alloc(SlabAllocator * slab) {
+    slab->live_objects++;
+
+    if (slab->free_list) {
+        void * object = slab->free_list;
+        slab->free_list = *(void **)object;
+        return object;
+    }
+
+    if (slab->cursor == slab->limit) slab_grow(slab);
+
+    void * object = slab->cursor;
+    slab->cursor += slab->object_size;
+    return object;
+}
+
+/**
+ * Returnează un obiect alocatorului, pentru a fi refolosit
+ * Complexitate: O(1)
+ * @param slab Alocatorul
+ * @param object Obiectul eliberat (poate fi NULL)
+ */
+void slab_free(SlabAllocator * slab, void * object) {
+    if (!object) return;
+    *(void **)object = slab->free_list;
+    slab->free_list = object;
+    slab->live_objects--;
+}
+
+/**
+ * Eliberează toate blocurile; toate obiectele alocate devin invalide
+ * Complexitate: O(numărul de blocuri)
+ * @param slab Alocatorul
+ */
+void slab_release(SlabAllocator * slab) {
+    SlabChunk * chunk = slab->chunks;
+    while (chunk) {
+        SlabChunk * next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    slab_init(slab, slab->object_size);
+}
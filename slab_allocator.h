@@ -0,0 +1,44 @@
+/**
+ * Alocator de tip slab pentru obiecte de dimensiune fixă (noduri și cărți)
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_SLAB_ALLOCATOR_H
+#define SDA_LAB4_SLAB_ALLOCATOR_H
+
+#include <stddef.h>
+
+/* Numărul de obiecte din primul bloc; blocurile următoare se dublează până la maxim */
+#define SLAB_FIRST_CHUNK_OBJECTS 64
+#define SLAB_MAX_CHUNK_OBJECTS 65536
+
+/**
+ * Antetul unui bloc de memorie; obiectele urmează imediat după antet
+ */
+typedef struct SlabChunk {
+    struct SlabChunk * next;           // Blocul alocat anterior
+    size_t capacity;                   // Numărul de obiecte din bloc
+} SlabChunk;
+
+/**
+ * Structură pentru alocatorul slab
+ * Obiectele sunt luate în ordine din blocul curent; obiectele eliberate intră
+ * într-o listă de obiecte libere și sunt refolosite înaintea celor noi.
+ */
+typedef struct SlabAllocator {
+    size_t object_size;                // Dimensiunea unui obiect (aliniată)
+    SlabChunk * chunks;                // Lista blocurilor alocate (cel mai nou primul)
+    char * cursor;                     // Următorul obiect nefolosit din blocul curent
+    char * limit;                      // Sfârșitul blocului curent
+    void * free_list;                  // Lista obiectelor eliberate
+    size_t next_chunk_objects;         // Dimensiunea următorului bloc
+    size_t live_objects;               // Numărul de obiecte în uz
+    size_t reserved_bytes;             // Memoria totală rezervată în blocuri
+} SlabAllocator;
+
+void slab_init(SlabAllocator * slab, size_t object_size);
+void * slab_alloc(SlabAllocator * slab);
+void slab_free(SlabAllocator * slab, void * object);
+void slab_release(SlabAllocator * slab);
+
+#endif // SDA_LAB4_SLAB_ALLOCATOR_H
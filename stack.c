@@ -0,0 +1,85 @@
+/**
+ * Stivă extensibilă pentru parcurgerile în adâncime ale arborelui
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#include <stdlib.h>
+
+#include "stack.h"
+#include "binary_tree.h"
+
+/**
+ * Creează o nouă stivă goală
+ * @return Pointer la noua stivă creată
+ */
+Stack * create_stack(void) {
+    Stack * stack = (Stack *)malloc(sizeof(Stack));
+    stack->capacity = STACK_INITIAL_CAPACITY;
+    stack->items = (BinaryTreeNode **)malloc(stack->capacity * sizeof(BinaryTreeNode *));
+    stack->size = 0;
+    return stack;
+}
+
+/**
+ * Eliberează memoria stivei și a tabloului de elemente
+ * @param stack Stiva care trebuie eliberată
+ */
+void free_stack(Stack * stack) {
+    if (!stack) return;
+    free(stack->items);
+    free(stack);
+}
+
+/**
+ * Golește stiva fără a elibera tabloul, pentru a-l refolosi la următorul apel
+ * @param stack Stiva care trebuie golită
+ */
+void stack_clear(Stack * stack) {
+    stack->size = 0;
+}
+
+/**
+ * Adaugă un nod în vârful stivei
+ * Complexitate: O(1) amortizat
+ * @param stack Stiva în care se va adăuga nodul
+ * @param tree_node Nodul din arbore care va fi adăugat
+ */
+void stack_push(Stack * stack, BinaryTreeNode * tree_node) {
+    // Dublăm tabloul dacă este plin
+    if (stack->size == stack->capacity) {
+        stack->capacity *= 2;
+        stack->items = (BinaryTreeNode **)realloc(stack->items, stack->capacity * sizeof(BinaryTreeNode *));
+    }
+
+    stack->items[stack->size++] = tree_node;
+}
+
+/**
+ * Elimină și returnează nodul din vârful stivei
+ * Complexitate: O(1)
+ * @param stack Stiva din care se va elimina nodul
+ * @return Nodul din vârful stivei sau NULL dacă stiva este goală
+ */
+BinaryTreeNode * stack_pop(Stack * stack) {
+    if (stack->size == 0) return NULL;
+    return stack->items[--stack->size];
+}
+
+/**
+ * Returnează nodul din vârful stivei fără să-l elimine
+ * @param stack Stiva
+ * @return Nodul din vârful stivei sau NULL dacă stiva este goală
+ */
+BinaryTreeNode * stack_peek(Stack * stack) {
+    if (stack->size == 0) return NULL;
+    return stack->items[stack->size - 1];
+}
+
+/**
+ * Verifică dacă stiva este goală
+ * @param stack Stiva care trebuie verificată
+ * @return true dacă stiva este goală, false în caz contrar
+ */
+bool is_stack_empty(Stack * stack) {
+    return stack->size == 0;
+}
@@ -0,0 +1,38 @@
+/**
+ * Stivă extensibilă pentru parcurgerile în adâncime ale arborelui
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_STACK_H
+#define SDA_LAB4_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Capacitatea inițială a stivei */
+#define STACK_INITIAL_CAPACITY 64
+
+struct BinaryTreeNode;
+
+/**
+ * Structură pentru stivă
+ * Înlocuiește stiva de apeluri a funcțiilor recursive: elementele sunt păstrate
+ * într-un tablou contiguu care crește prin dublare și nu se micșorează, deci
+ * un arbore degenerat de adâncime n nu mai depășește stiva C, iar stiva poate
+ * fi refolosită între apeluri fără alocări noi.
+ */
+typedef struct Stack {
+    struct BinaryTreeNode ** items;    // Tabloul cu elementele stivei
+    size_t capacity;                   // Capacitatea tabloului
+    size_t size;                       // Numărul de elemente din stivă
+} Stack;
+
+Stack * create_stack(void);
+void free_stack(Stack * stack);
+void stack_clear(Stack * stack);
+void stack_push(Stack * stack, struct BinaryTreeNode * tree_node);
+struct BinaryTreeNode * stack_pop(Stack * stack);
+struct BinaryTreeNode * stack_peek(Stack * stack);
+bool is_stack_empty(Stack * stack);
+
+#endif // SDA_LAB4_STACK_H
@@ -0,0 +1,241 @@
+/**
+ * Depozit de șiruri pentru titlurile și autorii cărților
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * O carte păstrează doar un pointer la titlu și identificatorul autorului,
+ * în loc de două tablouri fixe de câte 128 de caractere. Blocurile se eliberează
+ * toate odată, împreună cu arborele (clear_tree). Titlul unei cărți șterse individual
+ * își lasă locul într-o listă de locuri libere de aceeași dimensiune, de unde este
+ * luat de următorul titlu care încape exact în el.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "string_pool.h"
+
+/* Numărul de octeți folosiți pentru lungimea șirului */
+#define STRING_LENGTH_PREFIX 2
+
+/* Lungimea maximă a unui șir păstrat (limita prefixului de 2 octeți) */
+#define STRING_MAX_LENGTH 65535
+
+/**
+ * Inițializează un depozit gol; memoria se alocă la prima cerere
+ * @param pool Depozitul
+ */
+void string_pool_init(StringPool * pool) {
+    pool->blocks = NULL;
+    pool->authors = NULL;
+    pool->author_count = 0;
+    pool->author_capacity = 0;
+    pool->author_table = NULL;
+    pool->table_capacity = 0;
+    pool->reserved_bytes = 0;
+    for (int i = 0; i < STRING_FREE_CLASSES; i++) pool->free_slots[i] = NULL;
+}
+
+/**
+ * Returnează dimensiunea locului unui șir de lungimea dată (prefix, caractere și '\0', rotunjite)
+ */
+static size_t string_slot_size(size_t length) {
+    size_t bytes = STRING_LENGTH_PREFIX + length + 1;
+    return (bytes + STRING_SLOT_ALIGNMENT - 1) / STRING_SLOT_ALIGNMENT * STRING_SLOT_ALIGNMENT;
+}
+
+/**
+ * Rezervă spațiu pentru un șir în blocul curent, alocând un bloc nou la nevoie
+ * @param pool Depozitul
+ * @param bytes Numărul de octeți necesari
+ * @return Adresa spațiului rezervat
+ */
+static char * string_pool_reserve(StringPool * pool, size_t bytes) {
+    StringBlock * block = pool->blocks;
+
+    if (!block || block->capacity - block->used < bytes) {
+        size_t capacity = bytes > STRING_BLOCK_SIZE ? bytes : STRING_BLOCK_SIZE;
+        block = (StringBlock *)malloc(sizeof(StringBlock) + capacity);
+        block->used = 0;
+        block->capacity = capacity;
+        block->next = pool->blocks;
+        pool->blocks = block;
+        pool->reserved_bytes += sizeof(StringBlock) + capacity;
+    }
+
+    char * space = block->data + block->used;
+    block->used += bytes;
+    return space;
+}
+
+/**
+ * Copiază un șir în depozit, precedat de lungimea lui
+ * Șirurile mai lungi de 65535 de octeți sunt trunchiate.
+ * @param pool Depozitul
+ * @param text Șirul copiat
+ * @return Pointer la primul caracter al copiei (terminată cu '\0')
+ */
+const char * string_pool_store(StringPool * pool, const char * text) {
+    size_t length = strlen(text);
+    if (length > STRING_MAX_LENGTH) length = STRING_MAX_LENGTH;
+
+    // Un loc liber de aceeași dimensiune are prioritate; legătura spre următorul este la începutul lui
+    size_t slot_size = string_slot_size(length);
+    size_t size_class = slot_size / STRING_SLOT_ALIGNMENT - 1;
+    char * space;
+    if (size_class < STRING_FREE_CLASSES && pool->free_slots[size_class]) {
+        space = pool->free_slots[size_class];
+        memcpy(&pool->free_slots[size_class], space, sizeof(char *));
+    } else {
+        space = string_pool_reserve(pool, slot_size);
+    }
+
+    uint16_t prefix = (uint16_t)length;
+    memcpy(space, &prefix, STRING_LENGTH_PREFIX);
+    memcpy(space + STRING_LENGTH_PREFIX, text, length);
+    space[STRING_LENGTH_PREFIX + length] = '\0';
+
+    return space + STRING_LENGTH_PREFIX;
+}
+
+/**
+ * Returnează lungimea unui șir din depozit fără a-l parcurge
+ * @param stored Șirul returnat de string_pool_store()
+ * @return Lungimea șirului
+ */
+size_t string_pool_length(const char * stored) {
+    uint16_t prefix;
+    memcpy(&prefix, stored - STRING_LENGTH_PREFIX, STRING_LENGTH_PREFIX);
+    return prefix;
+}
+
+/**
+ * Dă înapoi locul unui șir care nu mai este folosit (titlul unei cărți șterse)
+ * Locurile de peste STRING_FREE_CLASSES * 8 octeți rămân ocupate până la string_pool_release().
+ * Numele autorilor internați nu trebuie date înapoi.
+ * Complexitate: O(1)
+ * @param pool Depozitul
+ * @param stored Șirul returnat de string_pool_store()
+ */
+void string_pool_discard(StringPool * pool, const char * stored) {
+    size_t size_class = string_slot_size(string_pool_length(stored)) / STRING_SLOT_ALIGNMENT - 1;
+    if (size_class >= STRING_FREE_CLASSES) return;
+
+    char * space = (char *)stored - STRING_LENGTH_PREFIX;
+    memcpy(space, &pool->free_slots[size_class], sizeof(char *));
+    pool->free_slots[size_class] = space;
+}
+
+/**
+ * Funcția de dispersie FNV-1a
+ * @param text Șirul
+ * @return Valoarea de dispersie
+ */
+static uint64_t string_hash(const char * text) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char * c = (const unsigned char *)text; *c; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Găsește poziția unui nume în tabela de dispersie (adresare deschisă, sondare liniară)
+ * @param pool Depozitul
+ * @param name Numele căutat
+ * @return Indicele poziției: fie cea care conține numele, fie prima poziție liberă
+ */
+static size_t author_slot(StringPool * pool, const char * name) {
+    size_t mask = pool->table_capacity - 1;
+    size_t slot = (size_t)string_hash(name) & mask;
+
+    while (pool->author_table[slot] != NOT_FOUND_AUTHOR &&
+           strcmp(pool->authors[pool->author_table[slot]], name) != 0) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * Dublează tabela de dispersie și reinserează identificatorii existenți
+ * @param pool Depozitul
+ */
+static void author_table_grow(StringPool * pool) {
+    size_t old_capacity = pool->table_capacity;
+    int * old_table = pool->author_table;
+
+    pool->table_capacity = old_capacity ? old_capacity * 2 : AUTHOR_TABLE_INITIAL_CAPACITY;
+    pool->author_table = (int *)malloc(pool->table_capacity * sizeof(int));
+    for (size_t i = 0; i < pool->table_capacity; i++) pool->author_table[i] = NOT_FOUND_AUTHOR;
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_table[i] == NOT_FOUND_AUTHOR) continue;
+        pool->author_table[author_slot(pool, pool->authors[old_table[i]])] = old_table[i];
+    }
+    free(old_table);
+}
+
+/**
+ * Caută un autor în depozit fără a-l adăuga
+ * @param pool Depozitul
+ * @param name Numele autorului
+ * @return Identificatorul autorului sau NOT_FOUND_AUTHOR
+ */
+int string_pool_find(StringPool * pool, const char * name) {
+    if (pool->table_capacity == 0) return NOT_FOUND_AUTHOR;
+    return pool->author_table[author_slot(pool, name)];
+}
+
+/**
+ * Internează numele unui autor: același nume primește mereu același identificator
+ * Complexitate: O(lungimea numelui) în medie
+ * @param pool Depozitul
+ * @param name Numele autorului
+ * @return Identificatorul autorului
+ */
+int string_pool_intern(StringPool * pool, const char * name) {
+    // Menținem factorul de încărcare sub 1/2
+    if ((size_t)(pool->author_count + 1) * 2 > pool->table_capacity) author_table_grow(pool);
+
+    size_t slot = author_slot(pool, name);
+    if (pool->author_table[slot] != NOT_FOUND_AUTHOR) return pool->author_table[slot];
+
+    if (pool->author_count == pool->author_capacity) {
+        pool->author_capacity = pool->author_capacity ? pool->author_capacity * 2 : AUTHOR_TABLE_INITIAL_CAPACITY;
+        pool->authors = (const char **)realloc(pool->authors, (size_t)pool->author_capacity * sizeof(char *));
+    }
+
+    int author_id = pool->author_count++;
+    pool->authors[author_id] = string_pool_store(pool, name);
+    pool->author_table[slot] = author_id;
+    return author_id;
+}
+
+/**
+ * Returnează numele unui autor după identificator
+ * @param pool Depozitul
+ * @param author_id Identificatorul autorului
+ * @return Numele autorului sau "" pentru un identificator necunoscut
+ */
+const char * string_pool_author(StringPool * pool, int author_id) {
+    if (author_id < 0 || author_id >= pool->author_count) return "";
+    return pool->authors[author_id];
+}
+
+/**
+ * Eliberează toate șirurile și tabela autorilor
+ * Complexitate: O(numărul de blocuri)
+ * @param pool Depozitul
+ */
+void string_pool_release(StringPool * pool) {
+    StringBlock * block = pool->blocks;
+    while (block) {
+        StringBlock * next = block->next;
+        free(block);
+        block = next;
+    }
+    free(pool->authors);
+    free(pool->author_table);
+    string_pool_init(pool);
+}
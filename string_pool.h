@@ -0,0 +1,65 @@
+/**
+ * Depozit de șiruri pentru titlurile și autorii cărților
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_STRING_POOL_H
+#define SDA_LAB4_STRING_POOL_H
+
+#include <stddef.h>
+
+/* Dimensiunea unui bloc de caractere */
+#define STRING_BLOCK_SIZE 65536
+
+/* Capacitatea inițială a tabelei de dispersie a autorilor (putere a lui 2) */
+#define AUTHOR_TABLE_INITIAL_CAPACITY 64
+
+/* Valoare returnată când un autor nu există în tabelă */
+#define NOT_FOUND_AUTHOR -1
+
+/* Locurile șirurilor sunt rotunjite la multipli de 8 octeți; cele de până la
+   STRING_FREE_CLASSES * 8 octeți sunt refolosite după string_pool_discard() */
+#define STRING_SLOT_ALIGNMENT 8
+#define STRING_FREE_CLASSES 32
+
+/**
+ * Bloc de caractere; șirurile sunt scrise unul după altul în câmpul data
+ */
+typedef struct StringBlock {
+    struct StringBlock * next;         // Blocul alocat anterior
+    size_t used;                       // Numărul de octeți ocupați
+    size_t capacity;                   // Numărul de octeți disponibili
+    char data[];                       // Conținutul blocului
+} StringBlock;
+
+/**
+ * Structură pentru depozitul de șiruri
+ * Fiecare șir este păstrat o singură dată, precedat de lungimea lui pe 2 octeți
+ * și urmat de '\0', deci poate fi folosit direct cu printf. Autorii sunt
+ * internați: un nume care apare de mai multe ori primește același identificator.
+ * Titlurile cărților șterse sunt date înapoi cu string_pool_discard() și locul lor
+ * este refolosit de următorul șir din aceeași clasă de dimensiune. Memoria crește
+ * deci cu numărul maxim de titluri păstrate simultan (pe clasă), nu cu numărul de
+ * inserări; doar șirurile mai lungi de 253 de caractere rămân până la string_pool_release().
+ */
+typedef struct StringPool {
+    StringBlock * blocks;              // Lista blocurilor (cel mai nou primul)
+    const char ** authors;             // Numele autorilor, indexate după identificator
+    int author_count;                  // Numărul de autori distincți
+    int author_capacity;               // Capacitatea tabloului authors
+    int * author_table;                // Tabela de dispersie: identificatori sau NOT_FOUND_AUTHOR
+    char * free_slots[STRING_FREE_CLASSES]; // Locurile eliberate, câte o listă pentru fiecare dimensiune
+    size_t table_capacity;             // Capacitatea tabelei (putere a lui 2)
+    size_t reserved_bytes;             // Memoria totală rezervată
+} StringPool;
+
+void string_pool_init(StringPool * pool);
+const char * string_pool_store(StringPool * pool, const char * text);
+size_t string_pool_length(const char * stored);
+void string_pool_discard(StringPool * pool, const char * stored);
+int string_pool_intern(StringPool * pool, const char * name);
+int string_pool_find(StringPool * pool, const char * name);
+const char * string_pool_author(StringPool * pool, int author_id);
+void string_pool_release(StringPool * pool);
+
+#endif // SDA_LAB4_STRING_POOL_H
@@ -0,0 +1,103 @@
+/**
+ * Test pentru range_sum() și range_max(), cu și fără agregatele tirajului
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Tirajele sunt păstrate și într-un tablou, iar fiecare interval este comparat cu
+ * suma și maximul calculate direct din tablou.
+ */
+
+#include "test_common.h"
+
+#define KEY_RANGE 1200
+#define OPERATIONS 12000
+#define MISSING -1                     // Cheia nu este în arbore
+
+/**
+ * Compară range_sum() și range_max() cu tabloul de tiraje pe intervale aleatoare
+ * @param tree Arborele verificat
+ * @param quantities Tirajul fiecărei chei sau MISSING
+ * @param seed Starea generatorului
+ */
+static void check_ranges(BinaryTree * tree, const int * quantities, uint64_t * seed) {
+    for (int i = 0; i < 40; i++) {
+        int lo = (int)(test_rand(seed) % (KEY_RANGE + 20)) - 10;
+        int hi = lo + (int)(test_rand(seed) % (KEY_RANGE / 2));
+        long long sum = 0;
+        int maximum = NOT_FOUND_QUANTITY;
+        for (int key = lo < 0 ? 0 : lo; key <= hi && key < KEY_RANGE; key++) {
+            if (quantities[key] == MISSING) continue;
+            sum += quantities[key];
+            maximum = max(maximum, quantities[key]);
+        }
+        CHECK(range_sum(tree, lo, hi) == sum);
+        CHECK(range_max(tree, lo, hi) == maximum);
+    }
+    CHECK(range_sum(tree, 10, 5) == 0);
+    CHECK(range_max(tree, 10, 5) == NOT_FOUND_QUANTITY);
+}
+
+/**
+ * Inserări, ștergeri și modificări de tiraj aleatoare, verificate periodic
+ * @param tree Arborele (gol)
+ * @param seed Starea generatorului
+ */
+static void run_operations(BinaryTree * tree, uint64_t * seed) {
+    int quantities[KEY_RANGE];
+    for (int key = 0; key < KEY_RANGE; key++) quantities[key] = MISSING;
+
+    for (int i = 0; i < OPERATIONS; i++) {
+        int key = (int)(test_rand(seed) % KEY_RANGE);
+        int quantity = (int)(test_rand(seed) % 100000);
+        int action = (int)(test_rand(seed) % 4);
+
+        if (quantities[key] == MISSING) {
+            insert(tree, create_book(tree, key, "Titlu", "Autor", 2000, 100, quantity));
+            quantities[key] = quantity;
+        } else if (action == 0) {
+            CHECK(update_quantity(tree, key, quantity));
+            quantities[key] = quantity;
+        } else {
+            CHECK(delete_key(tree, key));
+            quantities[key] = MISSING;
+        }
+
+        if (i % 3000 == 2999) {
+            if (!is_tree_balanced(tree)) balance_tree(tree);
+            check_tree(tree);
+            check_ranges(tree, quantities, seed);
+        }
+    }
+    CHECK(!update_quantity(tree, -1, 5));
+}
+
+int main(void) {
+    uint64_t seed = 0xA0761D6478BD642FULL;
+
+    for (int mode = TREE_UNBALANCED; mode <= TREE_SCAPEGOAT; mode++) {
+        // Cu agregate: pornite pe arborele gol
+        BinaryTree * tree = create_tree((TreeBalanceMode)mode);
+        CHECK(enable_quantity_aggregates(tree));
+        CHECK(enable_quantity_aggregates(tree));  // A doua oară nu schimbă nimic
+        run_operations(tree, &seed);
+        free_tree(tree);
+
+        // Fără agregate: aceleași rezultate prin parcurgerea intervalului
+        tree = create_tree((TreeBalanceMode)mode);
+        run_operations(tree, &seed);
+
+        // Pe un arbore cu noduri nu se pot porni, iar nodurile rămân valide
+        BinaryTreeNode * node = tree->root;
+        CHECK(node != NULL);
+        CHECK(!enable_quantity_aggregates(tree));
+        CHECK(!tree->quantity_aggregates);
+        CHECK(get(tree, node->key) == node);
+
+        // După golire se pot porni
+        clear_tree(tree);
+        CHECK(enable_quantity_aggregates(tree));
+        run_operations(tree, &seed);
+        free_tree(tree);
+    }
+
+    return test_report("test_aggregate");
+}
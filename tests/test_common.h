@@ -0,0 +1,121 @@
+/**
+ * Utilitare comune pentru teste
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Fiecare test este un program separat rulat de ctest: întoarce EXIT_SUCCESS
+ * dacă toate verificările au trecut. O verificare eșuată este afișată cu fișierul
+ * și linia, iar testul continuă, ca să se vadă toate diferențele dintr-o rulare.
+ */
+
+#ifndef SDA_LAB4_TEST_COMMON_H
+#define SDA_LAB4_TEST_COMMON_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "binary_tree.h"
+
+static int test_failures = 0;          // Numărul de verificări eșuate
+
+/**
+ * Verifică o condiție și numără eșecul, fără să oprească testul
+ */
+#define CHECK(condition) do { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: verificare esuata: %s\n", __FILE__, __LINE__, #condition); \
+        test_failures++; \
+    } \
+} while (0)
+
+/**
+ * Generator pseudo-aleator xorshift64*, ca în benchmark-uri, pentru teste reproductibile
+ * @param state Starea generatorului (nenulă)
+ * @return Următorul număr pseudo-aleator
+ */
+static inline uint64_t test_rand(uint64_t * state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * Verifică recursiv invarianții unui subarbore
+ * Cheile sunt în [lo, hi], cheia din nod este cea a cărții, iar datele păstrate în
+ * noduri (înălțime, culoare, dimensiune, agregate) corespund politicii arborelui.
+ * @param tree Arborele (pentru politică și opțiuni)
+ * @param tree_node Rădăcina subarborelui
+ * @param lo Cea mai mică cheie permisă
+ * @param hi Cea mai mare cheie permisă
+ * @param black_height Primește numărul de noduri negre până la frunze (modul roșu-negru)
+ * @return Numărul de noduri din subarbore
+ */
+static inline size_t check_subtree(BinaryTree * tree, BinaryTreeNode * tree_node, long long lo, long long hi, int * black_height) {
+    *black_height = 1;
+    if (!tree_node) return 0;
+
+    CHECK(tree_node->key >= lo && tree_node->key <= hi);
+    CHECK(tree_node->key == tree_node->book->key);
+
+    int left_black = 0, right_black = 0;
+    size_t left_count = check_subtree(tree, tree_node->left, lo, tree_node->key, &left_black);
+    size_t right_count = check_subtree(tree, tree_node->right, tree_node->key, hi, &right_black);
+
+    if (tree->mode == TREE_AVL) {
+        CHECK(tree_node->height == 1 + max(node_height(tree_node->left), node_height(tree_node->right)));
+        CHECK(abs(node_height(tree_node->left) - node_height(tree_node->right)) <= 1);
+    }
+    if (tree->mode == TREE_RED_BLACK) {
+        CHECK(left_black == right_black);
+        if (tree_node->color == NODE_RED) {
+            CHECK(!tree_node->left || tree_node->left->color == NODE_BLACK);
+            CHECK(!tree_node->right || tree_node->right->color == NODE_BLACK);
+        }
+        *black_height = left_black + (tree_node->color == NODE_BLACK);
+    }
+    if (tree->order_statistics) {
+        CHECK((size_t)tree_node->size == left_count + right_count + 1);
+    }
+    if (tree->quantity_aggregates) {
+        int quantity_max = max(tree_node->book->quantity_sold,
+                               max(node_quantity_max(tree_node->left), node_quantity_max(tree_node->right)));
+        CHECK(tree_node->aggregates);
+        CHECK(node_quantity_max(tree_node) == quantity_max);
+        CHECK(node_quantity_sum(tree_node) == tree_node->book->quantity_sold +
+              node_quantity_sum(tree_node->left) + node_quantity_sum(tree_node->right));
+    }
+
+    return left_count + right_count + 1;
+}
+
+/**
+ * Verifică invarianții întregului arbore (ordinea cheilor, numărul de noduri, balansarea)
+ * @param tree Arborele verificat
+ */
+static inline void check_tree(BinaryTree * tree) {
+    int black_height;
+    CHECK(check_subtree(tree, tree->root, LLONG_MIN, LLONG_MAX, &black_height) == tree->node_count);
+    if (tree->mode == TREE_RED_BLACK) {
+        CHECK(!tree->root || tree->root->color == NODE_BLACK);
+    }
+}
+
+/**
+ * Afișează rezultatul testului
+ * @param name Numele testului
+ * @return Codul de ieșire al programului
+ */
+static inline int test_report(const char * name) {
+    if (test_failures) {
+        fprintf(stderr, "%s: %d verificari esuate\n", name, test_failures);
+        return EXIT_FAILURE;
+    }
+    printf("%s: ok\n", name);
+    return EXIT_SUCCESS;
+}
+
+#endif // SDA_LAB4_TEST_COMMON_H
@@ -0,0 +1,155 @@
+/**
+ * Test pentru ConcurrentTree: cititori în paralel cu un scriitor
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Fiecare carte are titlul "Titlu <cheie>" și tirajul egal cu cheia, deci un
+ * cititor poate verifica orice carte găsită fără să știe ce a făcut scriitorul.
+ * Cititorii își refolosesc stiva și coada, inclusiv după o parcurgere oprită de
+ * vizitator. Rulat cu -DSDA_SANITIZER=thread verifică și lipsa curselor de date.
+ */
+
+#include <stdatomic.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "test_common.h"
+#include "concurrent_tree.h"
+
+#define KEY_RANGE 2000
+#define READERS 3
+#define WRITES 20000
+
+static ConcurrentTree * concurrent;
+static atomic_bool stop;
+
+/**
+ * Contextul vizitatorilor unui cititor
+ */
+typedef struct ReaderWalk {
+    long long last;                    // Ultima cheie vizitată (pentru ordine)
+    int lo, hi;                        // Intervalul cerut
+    size_t visited;                    // Numărul de noduri vizitate
+    size_t limit;                      // După câte noduri se oprește parcurgerea
+    bool valid;                        // Toate nodurile au fost în ordine, în interval și cu cartea corectă
+} ReaderWalk;
+
+/**
+ * Vizitator care verifică ordinea, intervalul și cartea nodului
+ * @param tree_node Nodul vizitat
+ * @param context Contextul (ReaderWalk *)
+ * @return false după limit noduri, true altfel
+ */
+static bool check_walk_node(BinaryTreeNode * tree_node, void * context) {
+    ReaderWalk * walk = (ReaderWalk *)context;
+    if (tree_node->key <= walk->last || tree_node->key < walk->lo || tree_node->key > walk->hi) walk->valid = false;
+    if (tree_node->book->quantity_sold != tree_node->key) walk->valid = false;
+    walk->last = tree_node->key;
+    return ++walk->visited < walk->limit;
+}
+
+/**
+ * Vizitator care doar numără nodurile
+ */
+static bool count_walk_node(BinaryTreeNode * tree_node, void * context) {
+    (void)tree_node;
+    ((ReaderWalk *)context)->visited++;
+    return true;
+}
+
+/**
+ * Firul cititor: căutări, parcurgeri oprite devreme și interogări pe intervale
+ * @param argument Sămânța generatorului
+ * @return Numărul de verificări eșuate
+ */
+static void * reader(void * argument) {
+    uint64_t seed = (uint64_t)(uintptr_t)argument;
+    Stack * stack = create_stack();
+    Queue * queue = create_queue();
+    size_t failures = 0;
+    char title[MAX_TITLE_LENGTH];
+    char expected[MAX_TITLE_LENGTH];
+
+    for (int i = 0; !atomic_load(&stop); i++) {
+        int key = (int)(test_rand(&seed) % KEY_RANGE);
+        Book book;
+        if (concurrent_get(concurrent, key, &book, title)) {
+            snprintf(expected, sizeof(expected), "Titlu %d", key);
+            if (book.key != key || book.quantity_sold != key || strcmp(title, expected) != 0) failures++;
+            if (book.prev_by_author || book.next_by_author) failures++;
+        }
+
+        if (i % 64 == 0) {
+            // Parcurgere în inordine oprită după câteva noduri: stiva rămâne plină
+            ReaderWalk walk = { LLONG_MIN, INT_MIN, INT_MAX, 0, 1 + (size_t)(test_rand(&seed) % 20), true };
+            concurrent_traverse_with(concurrent, TRAVERSAL_SVD, check_walk_node, &walk, stack, queue);
+            if (!walk.valid) failures++;
+
+            // Aceeași stivă, refolosită pentru un interval
+            int lo = (int)(test_rand(&seed) % KEY_RANGE);
+            walk = (ReaderWalk){ LLONG_MIN, lo, lo + 100, 0, (size_t)-1, true };
+            if (!concurrent_range_query_with(concurrent, walk.lo, walk.hi, check_walk_node, &walk, stack)) failures++;
+            if (!walk.valid || walk.visited > 101) failures++;
+
+            // Parcurgere în lățime oprită devreme, apoi una completă cu aceeași coadă
+            walk = (ReaderWalk){ LLONG_MIN, INT_MIN, INT_MAX, 0, 3, true };
+            concurrent_traverse_with(concurrent, TRAVERSAL_BFS, count_walk_node, &walk, stack, queue);
+            walk.visited = 0;
+            concurrent_traverse_with(concurrent, TRAVERSAL_BFS, count_walk_node, &walk, stack, queue);
+            if (walk.visited > KEY_RANGE) failures++;
+        }
+    }
+
+    free_stack(stack);
+    free_queue(queue);
+    return (void *)(uintptr_t)failures;
+}
+
+int main(void) {
+    int modes[] = { TREE_UNBALANCED, TREE_RED_BLACK };
+
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        concurrent = create_concurrent_tree((TreeBalanceMode)modes[m]);
+        atomic_store(&stop, false);
+        bool present[KEY_RANGE] = { false };
+        char title[MAX_TITLE_LENGTH];
+
+        pthread_t threads[READERS];
+        for (uintptr_t i = 0; i < READERS; i++) {
+            pthread_create(&threads[i], NULL, reader, (void *)(i + 1));
+        }
+
+        // Scriitorul: inserări și ștergeri aleatoare, cu balansări (arborele neechilibrat) și o golire
+        uint64_t seed = 0x5851F42D4C957F2DULL + m;
+        for (int i = 0; i < WRITES; i++) {
+            int key = (int)(test_rand(&seed) % KEY_RANGE);
+            if (present[key]) {
+                CHECK(concurrent_delete(concurrent, key));
+            } else {
+                snprintf(title, sizeof(title), "Titlu %d", key);
+                concurrent_insert(concurrent, key, title, "Autor", 2000, 100, key);
+            }
+            present[key] = !present[key];
+
+            if (i % 5000 == 4999 && modes[m] == TREE_UNBALANCED) concurrent_balance(concurrent);
+            if (i == WRITES / 2) {
+                concurrent_clear(concurrent);
+                for (int k = 0; k < KEY_RANGE; k++) present[k] = false;
+            }
+        }
+
+        atomic_store(&stop, true);
+        for (int i = 0; i < READERS; i++) {
+            void * failures;
+            pthread_join(threads[i], &failures);
+            CHECK((uintptr_t)failures == 0);
+        }
+
+        check_tree(concurrent->tree);
+        for (int key = 0; key < KEY_RANGE; key++) {
+            CHECK(concurrent_get(concurrent, key, NULL, NULL) == present[key]);
+        }
+        free_concurrent_tree(concurrent);
+    }
+
+    return test_report("test_concurrent");
+}
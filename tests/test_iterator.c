@@ -0,0 +1,109 @@
+/**
+ * Test pentru TreeIterator: seek, next și prev comparate cu un tablou de prezență
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#include "test_common.h"
+#include "tree_iterator.h"
+
+#define KEY_RANGE 600
+#define OPERATIONS 4000
+
+/**
+ * Returnează cea mai mică cheie prezentă >= key
+ * @param present Tabloul de prezență al cheilor 0..KEY_RANGE-1
+ * @param key Cheia căutată
+ * @return Cheia găsită sau -1 dacă nu există
+ */
+static int lower_bound(const bool * present, int key) {
+    for (int k = key < 0 ? 0 : key; k < KEY_RANGE; k++) {
+        if (present[k]) return k;
+    }
+    return -1;
+}
+
+/**
+ * Compară toate pozițiile iteratorului cu tabloul de prezență
+ * @param iterator Iteratorul verificat
+ * @param present Tabloul de prezență
+ * @param count Numărul de chei prezente
+ */
+static void check_iterator(TreeIterator * iterator, const bool * present, size_t count) {
+    // Parcurgere completă înainte și înapoi
+    size_t forward = 0;
+    int previous = -1;
+    for (BinaryTreeNode * node = tree_iterator_first(iterator); node; node = tree_iterator_next(iterator)) {
+        CHECK(node->key > previous && present[node->key]);
+        previous = node->key;
+        forward++;
+    }
+    CHECK(forward == count);
+    CHECK(tree_iterator_current(iterator) == NULL);
+
+    size_t backward = 0;
+    previous = KEY_RANGE;
+    for (BinaryTreeNode * node = tree_iterator_last(iterator); node; node = tree_iterator_prev(iterator)) {
+        CHECK(node->key < previous && present[node->key]);
+        previous = node->key;
+        backward++;
+    }
+    CHECK(backward == count);
+
+    // seek poziționează pe prima cheie >= key; un pas înainte și unul înapoi revin la ea
+    for (int key = -3; key < KEY_RANGE + 3; key++) {
+        int expected = lower_bound(present, key);
+        BinaryTreeNode * node = tree_iterator_seek(iterator, key);
+        if (expected < 0) {
+            CHECK(node == NULL);
+            continue;
+        }
+        CHECK(node && node->key == expected);
+        if (!node) continue;
+
+        int next_expected = lower_bound(present, expected + 1);
+        BinaryTreeNode * next = tree_iterator_next(iterator);
+        CHECK(next_expected < 0 ? next == NULL : (next && next->key == next_expected));
+        if (next) {
+            BinaryTreeNode * back = tree_iterator_prev(iterator);
+            CHECK(back && back->key == expected);
+        }
+    }
+}
+
+int main(void) {
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+
+    for (int mode = TREE_UNBALANCED; mode <= TREE_SCAPEGOAT; mode++) {
+        BinaryTree * tree = create_tree((TreeBalanceMode)mode);
+        TreeIterator * iterator = create_tree_iterator(tree);
+        bool present[KEY_RANGE] = { false };
+        size_t count = 0;
+
+        // Arbore gol
+        CHECK(tree_iterator_first(iterator) == NULL);
+        CHECK(tree_iterator_last(iterator) == NULL);
+        CHECK(tree_iterator_seek(iterator, 0) == NULL);
+
+        for (int i = 0; i < OPERATIONS; i++) {
+            int key = (int)(test_rand(&seed) % KEY_RANGE);
+            if (present[key]) {
+                CHECK(delete_key(tree, key));
+                count--;
+            } else {
+                insert(tree, create_book(tree, key, "Titlu", "Autor", 2000, 100, key));
+                count++;
+            }
+            present[key] = !present[key];
+
+            if (i % 500 == 499) {
+                check_tree(tree);
+                check_iterator(iterator, present, count);
+            }
+        }
+
+        free_tree_iterator(iterator);
+        free_tree(tree);
+    }
+
+    return test_report("test_iterator");
+}
@@ -0,0 +1,119 @@
+/**
+ * Test pentru OlcTree: inserări din mai multe fire și citiri simultane
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Firele inserează chei disjuncte, dar cu autori comuni, ca internarea aceluiași
+ * autor să se întâmple simultan. Cititorii verifică titlul și autorul fiecărei cărți
+ * găsite. Rulat cu -DSDA_SANITIZER=thread verifică și lipsa curselor de date.
+ */
+
+#include <stdatomic.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "test_common.h"
+#include "olc_tree.h"
+
+#define WRITERS 3
+#define READERS 2
+#define KEYS_PER_WRITER 3000
+#define AUTHORS 37
+
+static OlcTree * olc;
+static atomic_bool stop;
+
+/**
+ * Verifică o carte găsită: cheia, titlul "Titlu <cheie>" și autorul "Autor <cheie % AUTHORS>"
+ * @param book Cartea
+ * @param key Cheia căutată
+ * @return true dacă toate câmpurile sunt cele inserate
+ */
+static bool book_matches(const Book * book, int key) {
+    char expected[MAX_TITLE_LENGTH];
+    snprintf(expected, sizeof(expected), "Titlu %d", key);
+    if (book->key != key || book->quantity_sold != key || strcmp(book->title, expected) != 0) return false;
+    snprintf(expected, sizeof(expected), "Autor %d", key % AUTHORS);
+    return strcmp(olc_get_author(olc, book), expected) == 0;
+}
+
+/**
+ * Firul scriitor: inserează cheile writer, writer + WRITERS, ... în ordine amestecată
+ * @param argument Indicele scriitorului
+ * @return NULL
+ */
+static void * writer(void * argument) {
+    int index = (int)(uintptr_t)argument;
+    uint64_t seed = 0x9E3779B97F4A7C15ULL + (uint64_t)index;
+    int * keys = (int *)malloc(KEYS_PER_WRITER * sizeof(int));
+    for (int i = 0; i < KEYS_PER_WRITER; i++) keys[i] = i * WRITERS + index;
+    for (int i = KEYS_PER_WRITER - 1; i > 0; i--) {
+        int j = (int)(test_rand(&seed) % (uint64_t)(i + 1));
+        int swap = keys[i];
+        keys[i] = keys[j];
+        keys[j] = swap;
+    }
+
+    char title[MAX_TITLE_LENGTH];
+    char author[MAX_AUTHOR_LENGTH];
+    for (int i = 0; i < KEYS_PER_WRITER; i++) {
+        snprintf(title, sizeof(title), "Titlu %d", keys[i]);
+        snprintf(author, sizeof(author), "Autor %d", keys[i] % AUTHORS);
+        olc_insert(olc, keys[i], title, author, 2000, 100, keys[i]);
+    }
+
+    free(keys);
+    return NULL;
+}
+
+/**
+ * Firul cititor: caută chei aleatoare cât timp scriitorii lucrează
+ * @param argument Sămânța generatorului
+ * @return Numărul de cărți găsite cu alte date decât cele inserate
+ */
+static void * reader(void * argument) {
+    uint64_t seed = (uint64_t)(uintptr_t)argument;
+    size_t failures = 0;
+    while (!atomic_load(&stop)) {
+        int key = (int)(test_rand(&seed) % (WRITERS * KEYS_PER_WRITER));
+        const Book * book = olc_get(olc, key);
+        if (book && !book_matches(book, key)) failures++;
+    }
+    return (void *)(uintptr_t)failures;
+}
+
+int main(void) {
+    olc = create_olc_tree();
+    CHECK(olc_get(olc, 5) == NULL);
+
+    pthread_t writers[WRITERS], readers[READERS];
+    for (uintptr_t i = 0; i < READERS; i++) pthread_create(&readers[i], NULL, reader, (void *)(i + 1));
+    for (uintptr_t i = 0; i < WRITERS; i++) pthread_create(&writers[i], NULL, writer, (void *)i);
+    for (int i = 0; i < WRITERS; i++) pthread_join(writers[i], NULL);
+
+    atomic_store(&stop, true);
+    for (int i = 0; i < READERS; i++) {
+        void * failures;
+        pthread_join(readers[i], &failures);
+        CHECK((uintptr_t)failures == 0);
+    }
+
+    // Toate cărțile există, iar fiecare autor are un singur identificator
+    int author_ids[AUTHORS];
+    for (int i = 0; i < AUTHORS; i++) author_ids[i] = -1;
+    for (int key = 0; key < WRITERS * KEYS_PER_WRITER; key++) {
+        const Book * book = olc_get(olc, key);
+        CHECK(book && book_matches(book, key));
+        if (!book) continue;
+        int * id = &author_ids[key % AUTHORS];
+        if (*id < 0) *id = book->author_id;
+        CHECK(book->author_id == *id);
+    }
+    for (int i = 0; i < AUTHORS; i++) {
+        for (int j = i + 1; j < AUTHORS; j++) CHECK(author_ids[i] != author_ids[j]);
+    }
+    CHECK(olc_get(olc, -1) == NULL);
+    CHECK(olc_get(olc, WRITERS * KEYS_PER_WRITER) == NULL);
+
+    free_olc_tree(olc);
+    return test_report("test_olc");
+}
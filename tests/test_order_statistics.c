@@ -0,0 +1,84 @@
+/**
+ * Test pentru tree_select() și tree_rank(): comparate cu un tablou de prezență
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Dimensiunile subarborilor trebuie să rămână corecte după inserări, ștergeri,
+ * rotații, balance_tree() și mirror_tree().
+ */
+
+#include "test_common.h"
+
+#define KEY_RANGE 1500
+#define OPERATIONS 20000
+
+/**
+ * Compară select și rank pentru toate cheile cu tabloul de prezență
+ * @param tree Arborele verificat
+ * @param present Tabloul de prezență al cheilor 0..KEY_RANGE-1
+ */
+static void check_order_statistics(BinaryTree * tree, const bool * present) {
+    size_t rank = 0;
+    for (int key = 0; key < KEY_RANGE; key++) {
+        CHECK(tree_rank(tree, key) == rank);
+        if (present[key]) {
+            BinaryTreeNode * node = tree_select(tree, rank);
+            CHECK(node && node->key == key);
+            rank++;
+        }
+    }
+    CHECK(rank == tree->node_count);
+    CHECK(tree_select(tree, rank) == NULL);
+    CHECK(tree_rank(tree, INT_MAX) == rank);
+    CHECK(tree_rank(tree, INT_MIN) == 0);
+}
+
+int main(void) {
+    uint64_t seed = 0xD1B54A32D192ED03ULL;
+
+    for (int mode = TREE_UNBALANCED; mode <= TREE_SCAPEGOAT; mode++) {
+        BinaryTree * tree = create_tree((TreeBalanceMode)mode);
+        bool present[KEY_RANGE] = { false };
+
+        // Arbore gol
+        CHECK(tree_select(tree, 0) == NULL);
+        CHECK(tree_rank(tree, 10) == 0);
+
+        // O parte din chei înainte de activare: dimensiunile se calculează la enable_order_statistics()
+        for (int i = 0; i < KEY_RANGE / 3; i++) {
+            int key = (int)(test_rand(&seed) % KEY_RANGE);
+            if (present[key]) continue;
+            insert(tree, create_book(tree, key, "Titlu", "Autor", 2000, 100, key));
+            present[key] = true;
+        }
+        enable_order_statistics(tree);
+        check_tree(tree);
+        check_order_statistics(tree, present);
+
+        for (int i = 0; i < OPERATIONS; i++) {
+            int key = (int)(test_rand(&seed) % KEY_RANGE);
+            if (present[key]) {
+                CHECK(delete_key(tree, key));
+            } else {
+                insert(tree, create_book(tree, key, "Titlu", "Autor", 2000, 100, key));
+            }
+            present[key] = !present[key];
+
+            if (i % 2500 == 2499) {
+                if (!is_tree_balanced(tree)) balance_tree(tree);
+                check_tree(tree);
+
+                // Oglindirea inversează ordinea; a doua oglindire o restabilește
+                mirror_tree(tree);
+                mirror_tree(tree);
+                check_tree(tree);
+                check_order_statistics(tree, present);
+            }
+        }
+
+        CHECK(!delete_key(tree, -5));
+        check_tree(tree);
+        free_tree(tree);
+    }
+
+    return test_report("test_order_statistics");
+}
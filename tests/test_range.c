@@ -0,0 +1,144 @@
+/**
+ * Test pentru range_query() și range_count(), inclusiv prin ConcurrentTree și ShardedTree
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Cheile sunt multiplii lui 10 din [0, 390]. Intervalele de la margini (vid,
+ * după cea mai mare cheie, înaintea celei mai mici, [INT_MIN, INT_MAX]) sunt cele
+ * care lăsau stiva goală înainte de a găsi o cheie >= lo.
+ */
+
+#include "test_common.h"
+#include "concurrent_tree.h"
+#include "sharded_tree.h"
+
+#define KEY_COUNT 40
+#define KEY_STEP 10
+
+/**
+ * Contextul vizitatorului: numărul de chei vizitate și ultima cheie (pentru ordine)
+ */
+typedef struct RangeResult {
+    size_t count;
+    long long last;
+    bool ordered;
+} RangeResult;
+
+/**
+ * Vizitator care numără cheile și verifică ordinea crescătoare
+ * @param tree_node Nodul vizitat
+ * @param context Rezultatul (RangeResult *)
+ * @return true (parcurgerea continuă)
+ */
+static bool collect_key(BinaryTreeNode * tree_node, void * context) {
+    RangeResult * result = (RangeResult *)context;
+    if (tree_node->key <= result->last) result->ordered = false;
+    result->last = tree_node->key;
+    result->count++;
+    return true;
+}
+
+/**
+ * Numărul așteptat de chei din [lo, hi]
+ * @param lo Capătul stâng
+ * @param hi Capătul drept
+ * @return Numărul de multipli ai lui KEY_STEP din [0, (KEY_COUNT - 1) * KEY_STEP] aflați în interval
+ */
+static size_t expected_count(int lo, int hi) {
+    size_t count = 0;
+    for (int i = 0; i < KEY_COUNT; i++) {
+        int key = i * KEY_STEP;
+        if (key >= lo && key <= hi) count++;
+    }
+    return count;
+}
+
+static const int ranges[][2] = {
+    { 395, 1000 },              // lo după cea mai mare cheie
+    { 391, 391 },
+    { 390, INT_MAX },           // doar ultima cheie
+    { INT_MIN, INT_MAX },       // tot arborele
+    { INT_MIN, -1 },            // înaintea celei mai mici chei
+    { 5, 5 },                   // între două chei
+    { 100, 50 },                // lo > hi
+    { 15, 245 },
+    { 0, 0 },
+};
+
+#define RANGE_COUNT (sizeof(ranges) / sizeof(ranges[0]))
+
+/**
+ * Verifică toate intervalele pe un arbore obișnuit
+ * @param tree Arborele cu cheile de test (sau gol, cu empty = true)
+ * @param empty Dacă arborele este gol
+ */
+static void check_tree_ranges(BinaryTree * tree, bool empty) {
+    for (size_t i = 0; i < RANGE_COUNT; i++) {
+        int lo = ranges[i][0], hi = ranges[i][1];
+        size_t expected = empty ? 0 : expected_count(lo, hi);
+
+        RangeResult result = { 0, LLONG_MIN, true };
+        CHECK(range_query(tree, lo, hi, collect_key, &result));
+        CHECK(result.count == expected);
+        CHECK(result.ordered);
+        CHECK(range_count(tree, lo, hi) == expected);
+    }
+}
+
+int main(void) {
+    for (int mode = TREE_UNBALANCED; mode <= TREE_SCAPEGOAT; mode++) {
+        BinaryTree * tree = create_tree((TreeBalanceMode)mode);
+        check_tree_ranges(tree, true);
+
+        // Inserare în ordine crescătoare: în modul neechilibrat arborele este o liană spre dreapta
+        for (int i = 0; i < KEY_COUNT; i++) {
+            insert(tree, create_book(tree, i * KEY_STEP, "Titlu", "Autor", 2000, 100, i));
+        }
+        check_tree(tree);
+        check_tree_ranges(tree, false);
+
+        enable_order_statistics(tree);
+        check_tree(tree);
+        check_tree_ranges(tree, false);
+        free_tree(tree);
+    }
+
+    // Cazul din raport: AVL {1, 2, 3}, interval după toate cheile
+    BinaryTree * small = create_tree(TREE_AVL);
+    for (int key = 1; key <= 3; key++) insert(small, create_book(small, key, "Titlu", "Autor", 2000, 100, key));
+    CHECK(range_count(small, 10, 20) == 0);
+    free_tree(small);
+
+    // Aceleași intervale prin ConcurrentTree
+    Stack * stack = create_stack();
+    ConcurrentTree * concurrent = create_concurrent_tree(TREE_AVL);
+    for (int i = 0; i < KEY_COUNT; i++) {
+        concurrent_insert(concurrent, i * KEY_STEP, "Titlu", "Autor", 2000, 100, i);
+    }
+    for (size_t i = 0; i < RANGE_COUNT; i++) {
+        RangeResult result = { 0, LLONG_MIN, true };
+        CHECK(concurrent_range_query_with(concurrent, ranges[i][0], ranges[i][1], collect_key, &result, stack));
+        CHECK(result.count == expected_count(ranges[i][0], ranges[i][1]));
+        CHECK(result.ordered);
+    }
+    free_concurrent_tree(concurrent);
+    free_stack(stack);
+
+    // Și prin ShardedTree cu două partiții: intervalul poate începe după ultima cheie a unei partiții
+    int sample[KEY_COUNT];
+    for (int i = 0; i < KEY_COUNT; i++) sample[i] = i * KEY_STEP;
+    ShardedTree * sharded = create_sharded_tree(TREE_AVL, 2, sample, KEY_COUNT);
+    for (int i = 0; i < KEY_COUNT; i++) {
+        sharded_insert(sharded, i * KEY_STEP, "Titlu", "Autor", 2000, 100, i);
+    }
+    stack = create_stack();
+    for (size_t i = 0; i < RANGE_COUNT; i++) {
+        RangeResult result = { 0, LLONG_MIN, true };
+        CHECK(sharded_range_query_with(sharded, ranges[i][0], ranges[i][1], collect_key, &result, stack));
+        CHECK(result.count == expected_count(ranges[i][0], ranges[i][1]));
+        CHECK(result.ordered);
+    }
+    free_sharded_tree(sharded);
+    free_stack(stack);
+
+    return test_report("test_range");
+}
@@ -0,0 +1,188 @@
+/**
+ * Test pentru ShardedTree: rebalansarea, memoria șirurilor și cititori în timpul rebalansării
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Cheile pare sunt inserate la început și nu sunt șterse niciodată, deci orice
+ * cititor trebuie să le găsească mereu, chiar dacă sunt mutate între partiții.
+ * Rulat cu -DSDA_SANITIZER=thread verifică și lipsa curselor de date.
+ */
+
+#include <stdatomic.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "test_common.h"
+#include "sharded_tree.h"
+
+#define SHARDS 4
+#define BASE_KEYS 2000                 // Cheile pare 0, 2, ..., 2 * BASE_KEYS - 2
+#define SKEW_KEYS 2000                 // Chei inserate grupat, la un capăt al intervalului
+#define READERS 2
+#define ROUNDS 8
+
+static ShardedTree * sharded;
+static atomic_bool stop;
+
+/**
+ * Contextul vizitatorului: ordinea și numărul de chei pare vizitate
+ */
+typedef struct ShardWalk {
+    long long last;
+    size_t even;
+    bool ordered;
+} ShardWalk;
+
+static bool check_walk_node(BinaryTreeNode * tree_node, void * context) {
+    ShardWalk * walk = (ShardWalk *)context;
+    if (tree_node->key <= walk->last) walk->ordered = false;
+    walk->last = tree_node->key;
+    if (tree_node->key >= 0 && tree_node->key < 2 * BASE_KEYS && tree_node->key % 2 == 0) walk->even++;
+    return true;
+}
+
+/**
+ * Inserează cartea cheii, cu titlul "Titlu <cheie>" și unul din 5 autori
+ */
+static void insert_key(int key) {
+    char title[MAX_TITLE_LENGTH];
+    char author[MAX_AUTHOR_LENGTH];
+    snprintf(title, sizeof(title), "Titlu %d", key);
+    snprintf(author, sizeof(author), "Autor %d", ((key % 5) + 5) % 5);
+    sharded_insert(sharded, key, title, author, 2000, 100, key);
+}
+
+/**
+ * Verifică o carte găsită cu sharded_get()
+ */
+static bool book_matches(int key, const Book * book, const char * title, const char * author) {
+    char expected[MAX_TITLE_LENGTH];
+    snprintf(expected, sizeof(expected), "Titlu %d", key);
+    if (book->key != key || book->quantity_sold != key || strcmp(title, expected) != 0) return false;
+    snprintf(expected, sizeof(expected), "Autor %d", ((key % 5) + 5) % 5);
+    return strcmp(author, expected) == 0;
+}
+
+/**
+ * Firul cititor: cheile pare trebuie găsite mereu, iar intervalele trebuie să le conțină pe toate
+ * @param argument Sămânța generatorului
+ * @return Numărul de verificări eșuate
+ */
+static void * reader(void * argument) {
+    uint64_t seed = (uint64_t)(uintptr_t)argument;
+    Stack * stack = create_stack();
+    size_t failures = 0;
+    char title[MAX_TITLE_LENGTH];
+
+    for (int i = 0; !atomic_load(&stop); i++) {
+        int key = 2 * (int)(test_rand(&seed) % BASE_KEYS);
+        Book book;
+        const char * author;
+        if (!sharded_get(sharded, key, &book, title, &author) || !book_matches(key, &book, title, author)) failures++;
+
+        if (i % 32 == 0) {
+            ShardWalk walk = { LLONG_MIN, 0, true };
+            sharded_range_query_with(sharded, key, key + 99, check_walk_node, &walk, stack);
+            size_t expected = (size_t)((key + 99 < 2 * BASE_KEYS ? key + 99 : 2 * BASE_KEYS - 1) - key) / 2 + 1;
+            if (!walk.ordered || walk.even != expected) failures++;
+        }
+    }
+
+    free_stack(stack);
+    return (void *)(uintptr_t)failures;
+}
+
+/**
+ * Verifică partițiile: limitele, conținutul, invarianții și că nu și-au pornit dimensiunile
+ * @param expected_count Numărul total de cărți
+ */
+static void check_shards(size_t expected_count) {
+    size_t total = 0;
+    for (int i = 0; i < sharded->shard_count; i++) {
+        TreeShard * shard = &sharded->shards[i];
+        BinaryTree * tree = shard->concurrent->tree;
+        check_tree(tree);
+        CHECK(!tree->order_statistics);
+        if (i > 0) CHECK(shard->lower == sharded->shards[i - 1].upper);
+        if (tree->root) {
+            ShardWalk walk = { LLONG_MIN, 0, true };
+            CHECK(traverse_tree(tree, TRAVERSAL_SVD, check_walk_node, &walk));
+            CHECK(walk.ordered);
+            BinaryTreeNode * first = tree->root;
+            while (first->left) first = first->left;
+            BinaryTreeNode * last = tree->root;
+            while (last->right) last = last->right;
+            CHECK(first->key >= shard->lower && last->key < shard->upper);
+        }
+        total += tree->node_count;
+    }
+    CHECK(total == expected_count);
+    CHECK(sharded_node_count(sharded) == expected_count);
+}
+
+/**
+ * Memoria rezervată de depozitele de șiruri ale tuturor partițiilor
+ */
+static size_t string_bytes(void) {
+    size_t bytes = 0;
+    for (int i = 0; i < sharded->shard_count; i++) bytes += sharded->shards[i].concurrent->tree->strings.reserved_bytes;
+    return bytes;
+}
+
+int main(void) {
+    int sample[BASE_KEYS];
+    for (int i = 0; i < BASE_KEYS; i++) sample[i] = 2 * i;
+    sharded = create_sharded_tree(TREE_AVL, SHARDS, sample, BASE_KEYS);
+    for (int i = 0; i < BASE_KEYS; i++) insert_key(2 * i);
+    check_shards(BASE_KEYS);
+
+    // Inserări concentrate alternativ după ultima și înaintea primei chei, cu cititori în timpul rebalansării.
+    // Cărțile trec astfel dintr-o partiție în alta la fiecare rundă.
+    size_t bytes_after_warmup = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        int first_key = round % 2 == 0 ? 2 * BASE_KEYS : -SKEW_KEYS;
+        for (int key = first_key; key < first_key + SKEW_KEYS; key++) insert_key(key);
+
+        atomic_store(&stop, false);
+        pthread_t threads[READERS];
+        for (uintptr_t i = 0; i < READERS; i++) pthread_create(&threads[i], NULL, reader, (void *)(i + 1 + round * READERS));
+        sharded_rebalance(sharded);
+        atomic_store(&stop, true);
+        for (int i = 0; i < READERS; i++) {
+            void * failures;
+            pthread_join(threads[i], &failures);
+            CHECK((uintptr_t)failures == 0);
+        }
+
+        check_shards(BASE_KEYS + SKEW_KEYS);
+        for (int i = 0; i < sharded->shard_count; i++) {
+            // Fiecare partiție are aproximativ un sfert din cărți
+            size_t count = sharded->shards[i].concurrent->tree->node_count;
+            CHECK(count * SHARDS <= (BASE_KEYS + SKEW_KEYS) * 5 / 4);
+        }
+
+        for (int key = first_key; key < first_key + SKEW_KEYS; key++) CHECK(sharded_delete(sharded, key));
+        check_shards(BASE_KEYS);
+
+        // După primele două runde (câte una în fiecare direcție), memoria șirurilor nu mai crește
+        if (round == 1) bytes_after_warmup = string_bytes();
+        if (round > 1) CHECK(string_bytes() <= bytes_after_warmup);
+    }
+
+    // Toate cheile pare, cu toate datele lor
+    char title[MAX_TITLE_LENGTH];
+    for (int i = 0; i < BASE_KEYS; i++) {
+        Book book;
+        const char * author;
+        CHECK(sharded_get(sharded, 2 * i, &book, title, &author) && book_matches(2 * i, &book, title, author));
+        CHECK(!sharded_get(sharded, 2 * i + 1, NULL, NULL, NULL));
+    }
+
+    Stack * stack = create_stack();
+    ShardWalk walk = { LLONG_MIN, 0, true };
+    CHECK(sharded_traverse_with(sharded, check_walk_node, &walk, stack));
+    CHECK(walk.ordered && walk.even == BASE_KEYS);
+    free_stack(stack);
+
+    free_sharded_tree(sharded);
+    return test_report("test_sharded");
+}
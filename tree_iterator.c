@@ -0,0 +1,171 @@
+/**
+ * Iterator în ordinea cheilor (inordine) pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ *
+ * Paginarea ("următoarele 100 de cărți după cheia K") costă O(log n) pentru
+ * poziționare și O(1) amortizat pentru fiecare carte, în loc de o parcurgere
+ * SVD de la cea mai mică cheie.
+ */
+
+#include <stdlib.h>
+
+#include "tree_iterator.h"
+
+/**
+ * Creează un iterator pentru arbore, poziționat după ultimul element
+ * @param tree Arborele parcurs
+ * @return Pointer la noul iterator
+ */
+TreeIterator * create_tree_iterator(BinaryTree * tree) {
+    TreeIterator * iterator = (TreeIterator *)malloc(sizeof(TreeIterator));
+    iterator->tree = tree;
+    iterator->path = create_stack();
+    return iterator;
+}
+
+/**
+ * Eliberează iteratorul (arborele nu este afectat)
+ * @param iterator Iteratorul care trebuie eliberat
+ */
+void free_tree_iterator(TreeIterator * iterator) {
+    if (!iterator) return;
+    free_stack(iterator->path);
+    free(iterator);
+}
+
+/**
+ * Returnează nodul curent al iteratorului
+ * @param iterator Iteratorul
+ * @return Nodul curent sau NULL dacă iteratorul a trecut de capătul arborelui
+ */
+BinaryTreeNode * tree_iterator_current(TreeIterator * iterator) {
+    return stack_peek(iterator->path);
+}
+
+/**
+ * Coboară din nodul dat mereu spre stânga, adăugând nodurile pe drum
+ * @param path Drumul iteratorului
+ * @param tree_node Nodul de pornire
+ */
+static void descend_left(Stack * path, BinaryTreeNode * tree_node) {
+    while (tree_node) {
+        stack_push(path, tree_node);
+        tree_node = tree_node->left;
+    }
+}
+
+/**
+ * Coboară din nodul dat mereu spre dreapta, adăugând nodurile pe drum
+ * @param path Drumul iteratorului
+ * @param tree_node Nodul de pornire
+ */
+static void descend_right(Stack * path, BinaryTreeNode * tree_node) {
+    while (tree_node) {
+        stack_push(path, tree_node);
+        tree_node = tree_node->right;
+    }
+}
+
+/**
+ * Poziționează iteratorul pe cea mai mică cheie
+ * Complexitate: O(h)
+ * @param iterator Iteratorul
+ * @return Primul nod sau NULL dacă arborele este gol
+ */
+BinaryTreeNode * tree_iterator_first(TreeIterator * iterator) {
+    stack_clear(iterator->path);
+    descend_left(iterator->path, iterator->tree->root);
+    return tree_iterator_current(iterator);
+}
+
+/**
+ * Poziționează iteratorul pe cea mai mare cheie
+ * Complexitate: O(h)
+ * @param iterator Iteratorul
+ * @return Ultimul nod sau NULL dacă arborele este gol
+ */
+BinaryTreeNode * tree_iterator_last(TreeIterator * iterator) {
+    stack_clear(iterator->path);
+    descend_right(iterator->path, iterator->tree->root);
+    return tree_iterator_current(iterator);
+}
+
+/**
+ * Poziționează iteratorul pe primul nod cu cheia mai mare sau egală cu key (lower bound)
+ * Drumul până la candidat este chiar începutul drumului de căutare, așa că la
+ * final stiva este trunchiată la adâncimea ultimului candidat găsit.
+ * Complexitate: O(h)
+ * @param iterator Iteratorul
+ * @param key Cheia căutată
+ * @return Nodul găsit sau NULL dacă toate cheile sunt mai mici
+ */
+BinaryTreeNode * tree_iterator_seek(TreeIterator * iterator, int key) {
+    Stack * path = iterator->path;
+    size_t candidate_depth = 0;  // Dimensiunea stivei când vârful este candidatul (0 = niciunul)
+
+    stack_clear(path);
+    BinaryTreeNode * current = iterator->tree->root;
+    while (current) {
+        stack_push(path, current);
+        if (current->key >= key) {
+            candidate_depth = path->size;  // Candidat; căutăm unul mai mic în stânga
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+
+    path->size = candidate_depth;
+    return tree_iterator_current(iterator);
+}
+
+/**
+ * Avansează iteratorul la următoarea cheie în ordine crescătoare
+ * Dacă nodul curent are subarbore drept, următorul este cel mai din stânga nod
+ * al acestuia; altfel urcăm până ieșim dintr-un subarbore stâng.
+ * Complexitate: O(1) amortizat
+ * @param iterator Iteratorul
+ * @return Nodul următor sau NULL dacă nodul curent era ultimul
+ */
+BinaryTreeNode * tree_iterator_next(TreeIterator * iterator) {
+    Stack * path = iterator->path;
+    BinaryTreeNode * current = stack_peek(path);
+    if (!current) return NULL;  // Iteratorul a trecut deja de capăt
+
+    if (current->right) {
+        descend_left(path, current->right);
+        return stack_peek(path);
+    }
+
+    // Urcăm cât timp venim dintr-un subarbore drept
+    BinaryTreeNode * child = stack_pop(path);
+    while (!is_stack_empty(path) && stack_peek(path)->right == child) {
+        child = stack_pop(path);
+    }
+    return stack_peek(path);
+}
+
+/**
+ * Mută iteratorul la cheia anterioară în ordine crescătoare
+ * Un iterator care a trecut de capăt se mută pe ultima cheie.
+ * Complexitate: O(1) amortizat
+ * @param iterator Iteratorul
+ * @return Nodul anterior sau NULL dacă nodul curent era primul
+ */
+BinaryTreeNode * tree_iterator_prev(TreeIterator * iterator) {
+    Stack * path = iterator->path;
+    BinaryTreeNode * current = stack_peek(path);
+    if (!current) return tree_iterator_last(iterator);
+
+    if (current->left) {
+        descend_right(path, current->left);
+        return stack_peek(path);
+    }
+
+    // Urcăm cât timp venim dintr-un subarbore stâng
+    BinaryTreeNode * child = stack_pop(path);
+    while (!is_stack_empty(path) && stack_peek(path)->left == child) {
+        child = stack_pop(path);
+    }
+    return stack_peek(path);
+}
@@ -0,0 +1,34 @@
+/**
+ * Iterator în ordinea cheilor (inordine) pentru arborele binar de căutare
+ * Lucrare de laborator nr. 4 - Structuri de Date și Algoritmi
+ */
+
+#ifndef SDA_LAB4_TREE_ITERATOR_H
+#define SDA_LAB4_TREE_ITERATOR_H
+
+#include "binary_tree.h"
+#include "stack.h"
+
+/**
+ * Structură pentru iterator
+ * Nodurile nu au pointer la părinte, așa că iteratorul păstrează drumul de la
+ * rădăcină la nodul curent într-o stivă proprie. Stiva crește doar până la
+ * adâncimea arborelui și este refolosită, deci pașii nu fac alocări.
+ * Iteratorul devine invalid după orice inserare, ștergere sau balansare;
+ * după o modificare se repoziționează cu tree_iterator_seek().
+ */
+typedef struct TreeIterator {
+    BinaryTree * tree;                 // Arborele parcurs
+    Stack * path;                      // Drumul de la rădăcină la nodul curent (vârful stivei)
+} TreeIterator;
+
+TreeIterator * create_tree_iterator(BinaryTree * tree);
+void free_tree_iterator(TreeIterator * iterator);
+BinaryTreeNode * tree_iterator_current(TreeIterator * iterator);
+BinaryTreeNode * tree_iterator_first(TreeIterator * iterator);
+BinaryTreeNode * tree_iterator_last(TreeIterator * iterator);
+BinaryTreeNode * tree_iterator_seek(TreeIterator * iterator, int key);
+BinaryTreeNode * tree_iterator_next(TreeIterator * iterator);
+BinaryTreeNode * tree_iterator_prev(TreeIterator * iterator);
+
+#endif // SDA_LAB4_TREE_ITERATOR_H